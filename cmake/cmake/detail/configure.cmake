@@ -15,6 +15,8 @@ set(vsm_detail_configure_lib_opt_n
 	HEADER_DEFINITIONS
 	TEST_SOURCES
 	TEST_LINK_LIBRARIES
+	BENCHMARK_SOURCES
+	BENCHMARK_LINK_LIBRARIES
 	INTERNAL_LINK_LIBRARIES
 )
 
@@ -251,6 +253,50 @@ function(vsm_detail_configure name target public_type)
 		endif()
 	endif()
 
+	if(DEFINED VSM_OPT_BENCHMARK_SOURCES)
+		if(vsm_detail_do_configure)
+			if(NOT "${benchmark_FOUND}")
+				find_package(benchmark QUIET)
+			endif()
+
+			# Benchmarks are optional. They are only built if Google Benchmark is available.
+			if("${benchmark_FOUND}")
+				get_target_property(benchmark_target ${target} vsm_detail_benchmark_target)
+
+				if(${benchmark_target} STREQUAL "benchmark_target-NOTFOUND")
+					set(benchmark_target ${target}_benchmark)
+					set_property(TARGET ${target} PROPERTY vsm_detail_benchmark_target ${benchmark_target})
+
+					add_executable(${benchmark_target})
+					add_executable(${name}-benchmark ALIAS ${benchmark_target})
+					set_target_properties(${benchmark_target} PROPERTIES FOLDER "BenchmarkExecutables")
+
+					target_include_directories(${benchmark_target} PRIVATE source)
+					target_link_libraries(
+						${benchmark_target}
+						PRIVATE
+							${target}
+							vsm_detail_cxx_options
+							benchmark::benchmark_main)
+				endif()
+
+				target_sources(${benchmark_target} PRIVATE ${VSM_OPT_BENCHMARK_SOURCES})
+			endif()
+		endif()
+
+		vsm_detail_add_directory_files("sources" "${VSM_OPT_BENCHMARK_SOURCES}")
+	endif()
+
+	if(vsm_detail_do_configure AND DEFINED VSM_OPT_BENCHMARK_LINK_LIBRARIES)
+		get_target_property(benchmark_target ${target} vsm_detail_benchmark_target)
+
+		if(NOT ${benchmark_target} STREQUAL "benchmark_target-NOTFOUND")
+			target_link_libraries(${benchmark_target} PRIVATE ${VSM_OPT_BENCHMARK_LINK_LIBRARIES})
+		elseif(NOT DEFINED VSM_OPT_BENCHMARK_SOURCES)
+			message(SEND_ERROR "Cannot specify benchmark dependencies for target ${target} without benchmark sources.")
+		endif()
+	endif()
+
 	if(vsm_detail_do_configure AND DEFINED VSM_OPT_INTERNAL_LINK_LIBRARIES)
 		target_link_libraries(${target} PRIVATE ${VSM_OPT_INTERNAL_LINK_LIBRARIES})
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vsm/allocator.hpp>
+
+namespace vsm {
+namespace detail {
+
+inline constexpr size_t _mmap_allocator_page_size = 4096;
+inline constexpr size_t _mmap_allocator_huge_page_size = 2 * 1024 * 1024;
+inline constexpr size_t _mmap_allocator_gigantic_page_size = 1024 * 1024 * 1024;
+
+// Large pages are only used for blocks spanning at least this many of them, such that rounding the
+// size up to a multiple of the large page size wastes at most one eighth of the block.
+inline constexpr size_t _mmap_allocator_min_large_page_count = 8;
+
+// Returns the size of the largest page which may be used for a block of the specified size. Being
+// a function of the size alone, it can be recomputed when the block is resized or deallocated.
+[[nodiscard]] constexpr size_t _mmap_allocator_granularity(size_t const size) noexcept
+{
+	if constexpr (sizeof(size_t) >= 8)
+	{
+		if (size / _mmap_allocator_min_large_page_count >= _mmap_allocator_gigantic_page_size)
+		{
+			return _mmap_allocator_gigantic_page_size;
+		}
+	}
+
+	if (size / _mmap_allocator_min_large_page_count >= _mmap_allocator_huge_page_size)
+	{
+		return _mmap_allocator_huge_page_size;
+	}
+
+	return _mmap_allocator_page_size;
+}
+
+[[nodiscard]] constexpr size_t _mmap_allocator_mapping_size(size_t const size) noexcept
+{
+	size_t const granularity = _mmap_allocator_granularity(size);
+	return (size + granularity - 1) & ~(granularity - 1);
+}
+
+} // namespace detail
+
+// Allocates large blocks directly from the operating system, preferring large pages in order to
+// reduce TLB misses when accessing large hash tables and arrays. Blocks smaller than
+// min_mapping_size are allocated using ::operator new instead.
+//
+// On Linux, blocks spanning at least eight large pages are first mapped using pages of the largest
+// fitting size (1 GiB or 2 MiB) from the reserved hugetlbfs pool. If the pool cannot satisfy the
+// request, the block is mapped using normal pages aligned to 2 MiB and advised with
+// MADV_HUGEPAGE, such that it may be backed by transparent huge pages. Blocks are resized in place
+// using mremap if the address space following the block is available, and reallocated using
+// mremap with MREMAP_MAYMOVE, which moves the pages of the block without copying their contents.
+// Blocks growing large enough for a larger page size are not resized in place. Instead they are
+// copied into a new mapping using the larger pages, unless no such pages are available for the new
+// mapping, in which case the block is remapped.
+//
+// On Windows, large pages are used if the process holds the privilege to lock pages in memory.
+//
+// The size of a block passed to deallocate, resize or reallocate may be smaller than the size
+// returned for it, such as the size of the whole elements fitting within the block, but must be
+// no smaller than the minimum size requested for it.
+class mmap_allocator
+{
+public:
+	static constexpr bool is_always_equal = true;
+	static constexpr bool is_propagatable = true;
+
+	static constexpr size_t min_mapping_size = 64 * 1024;
+
+	[[nodiscard]] allocation allocate(size_t min_size, size_t max_size) const noexcept;
+	void deallocate(allocation allocation) const noexcept;
+
+	// Resizes a block in place, returning its new size, or zero if it could not be resized.
+	[[nodiscard]] size_t resize(
+		allocation allocation,
+		size_t min_size,
+		size_t max_size) const noexcept;
+
+	// Moves the contents of a block into a block of a different size, which may be at a different
+	// address. Where possible, the pages of the old block are remapped instead of being copied.
+	[[nodiscard]] allocation reallocate(
+		allocation allocation,
+		size_t min_size,
+		size_t max_size) const noexcept;
+};
+
+} // namespace vsm
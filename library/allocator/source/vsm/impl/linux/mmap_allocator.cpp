@@ -0,0 +1,338 @@
+#include <vsm/mmap_allocator.hpp>
+
+#include <vsm/assert.h>
+
+#include <algorithm>
+#include <new>
+
+#include <cstring>
+
+#include <sys/mman.h>
+
+#ifndef MAP_HUGE_SHIFT
+#	define MAP_HUGE_SHIFT 26
+#endif
+
+#ifndef MAP_HUGE_2MB
+#	define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+
+#ifndef MAP_HUGE_1GB
+#	define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+using namespace vsm;
+using namespace vsm::detail;
+
+static void* map_pages(size_t const size, int const flags) noexcept
+{
+	void* const storage = mmap(
+		nullptr,
+		size,
+		PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | flags,
+		-1,
+		0);
+
+	return storage != MAP_FAILED ? storage : nullptr;
+}
+
+// Maps normal pages aligned to the huge page size, such that the kernel may back the entire block
+// with transparent huge pages.
+static void* map_transparent_huge_pages(size_t const size) noexcept
+{
+	size_t const padded_size = size + _mmap_allocator_huge_page_size;
+
+	auto const padded_storage = static_cast<unsigned char*>(map_pages(padded_size, 0));
+
+	if (padded_storage == nullptr)
+	{
+		return nullptr;
+	}
+
+	uintptr_t const alignment_mask = _mmap_allocator_huge_page_size - 1;
+	uintptr_t const padded_address = reinterpret_cast<uintptr_t>(padded_storage);
+	uintptr_t const address = (padded_address + alignment_mask) & ~alignment_mask;
+
+	auto const storage = padded_storage + (address - padded_address);
+
+	if (size_t const head_size = static_cast<size_t>(storage - padded_storage))
+	{
+		munmap(padded_storage, head_size);
+	}
+
+	if (size_t const tail_size = padded_size - size - static_cast<size_t>(storage - padded_storage))
+	{
+		munmap(storage + size, tail_size);
+	}
+
+	(void)madvise(storage, size, MADV_HUGEPAGE);
+
+	return storage;
+}
+
+static void* map(size_t const size) noexcept
+{
+	size_t const granularity = _mmap_allocator_granularity(size);
+
+	if (granularity >= _mmap_allocator_gigantic_page_size)
+	{
+		if (void* const storage = map_pages(size, MAP_HUGETLB | MAP_HUGE_1GB))
+		{
+			return storage;
+		}
+	}
+
+	if (granularity >= _mmap_allocator_huge_page_size)
+	{
+		if (void* const storage = map_pages(size, MAP_HUGETLB | MAP_HUGE_2MB))
+		{
+			return storage;
+		}
+
+		return map_transparent_huge_pages(size);
+	}
+
+	return map_pages(size, 0);
+}
+
+// Remaps a block, possibly moving it, such that the new mapping is aligned to the specified
+// alignment. A mapping moved by MREMAP_MAYMOVE alone is not necessarily aligned to the huge page
+// size, so larger alignments are satisfied by moving the mapping onto an aligned reservation.
+static void* remap_aligned(
+	void* const storage,
+	size_t const old_size,
+	size_t const new_size,
+	size_t const alignment) noexcept
+{
+	// Resizing in place keeps the alignment of the block.
+	if (reinterpret_cast<uintptr_t>(storage) % alignment == 0)
+	{
+		if (void* const new_storage = mremap(storage, old_size, new_size, 0); new_storage != MAP_FAILED)
+		{
+			return new_storage;
+		}
+	}
+
+	if (alignment <= _mmap_allocator_page_size)
+	{
+		void* const new_storage = mremap(storage, old_size, new_size, MREMAP_MAYMOVE);
+		return new_storage != MAP_FAILED ? new_storage : nullptr;
+	}
+
+	size_t const padded_size = new_size + alignment;
+
+	auto const padded_storage = static_cast<unsigned char*>(mmap(
+		nullptr,
+		padded_size,
+		PROT_NONE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+		-1,
+		0));
+
+	if (padded_storage == MAP_FAILED)
+	{
+		return nullptr;
+	}
+
+	uintptr_t const alignment_mask = alignment - 1;
+	uintptr_t const padded_address = reinterpret_cast<uintptr_t>(padded_storage);
+	uintptr_t const address = (padded_address + alignment_mask) & ~alignment_mask;
+
+	auto const new_storage = padded_storage + (address - padded_address);
+
+	if (mremap(storage, old_size, new_size, MREMAP_MAYMOVE | MREMAP_FIXED, new_storage) == MAP_FAILED)
+	{
+		munmap(padded_storage, padded_size);
+		return nullptr;
+	}
+
+	// The aligned part of the reservation was replaced by the moved mapping.
+	if (size_t const head_size = static_cast<size_t>(new_storage - padded_storage))
+	{
+		munmap(padded_storage, head_size);
+	}
+
+	if (size_t const tail_size = padded_size - new_size - static_cast<size_t>(new_storage - padded_storage))
+	{
+		munmap(new_storage + new_size, tail_size);
+	}
+
+	return new_storage;
+}
+
+// Returns the length of the mapping backing a block. The size of the allocation may be anywhere
+// between the size requested and the size returned when the block was last allocated or resized.
+// Being at least the requested size, it rounds up to the same multiple of the same granularity.
+static size_t get_mapping_size(allocation const allocation) noexcept
+{
+	size_t const alignment = std::min(
+		_mmap_allocator_granularity(allocation.size),
+		_mmap_allocator_huge_page_size);
+
+	vsm_assert(reinterpret_cast<uintptr_t>(allocation.storage) % alignment == 0);
+	return _mmap_allocator_mapping_size(allocation.size);
+}
+
+
+allocation mmap_allocator::allocate(size_t const min_size, size_t const max_size) const noexcept
+{
+	if (min_size < min_mapping_size)
+	{
+		return allocation(::operator new(min_size, std::nothrow), min_size);
+	}
+
+	size_t const mapping_size = _mmap_allocator_mapping_size(min_size);
+
+	if (mapping_size < min_size)
+	{
+		return allocation(nullptr);
+	}
+
+	void* const storage = map(mapping_size);
+
+	if (storage == nullptr)
+	{
+		return allocation(nullptr);
+	}
+
+	return allocation(storage, std::min(mapping_size, max_size));
+}
+
+void mmap_allocator::deallocate(allocation const allocation) const noexcept
+{
+	if (allocation.size < min_mapping_size)
+	{
+		::operator delete(allocation.storage, allocation.size);
+	}
+	else
+	{
+		munmap(allocation.storage, get_mapping_size(allocation));
+	}
+}
+
+size_t mmap_allocator::resize(
+	allocation const allocation,
+	size_t const min_size,
+	size_t const max_size) const noexcept
+{
+	// Blocks allocated using ::operator new cannot be resized in place, and neither can mapped
+	// blocks be resized below the mapping threshold without changing how they are deallocated.
+	if (allocation.size < min_mapping_size || min_size < min_mapping_size)
+	{
+		return 0;
+	}
+
+	size_t const old_mapping_size = get_mapping_size(allocation);
+	size_t const new_mapping_size = _mmap_allocator_mapping_size(min_size);
+
+	if (new_mapping_size < min_size)
+	{
+		return 0;
+	}
+
+	// Resizing in place keeps the page size of the old mapping. A block growing into a larger page
+	// granularity is instead reallocated, such that it may be mapped using large pages.
+	if (_mmap_allocator_granularity(min_size) > _mmap_allocator_granularity(allocation.size))
+	{
+		return 0;
+	}
+
+	// The mapping size may round up into a larger granularity, requiring a larger alignment.
+	size_t const alignment = std::min(
+		_mmap_allocator_granularity(new_mapping_size),
+		_mmap_allocator_huge_page_size);
+
+	if (reinterpret_cast<uintptr_t>(allocation.storage) % alignment != 0)
+	{
+		return 0;
+	}
+
+	if (new_mapping_size != old_mapping_size)
+	{
+		// Without MREMAP_MAYMOVE the mapping is either resized in place or not at all.
+		void* const storage = mremap(allocation.storage, old_mapping_size, new_mapping_size, 0);
+
+		if (storage == MAP_FAILED)
+		{
+			return 0;
+		}
+	}
+
+	return std::min(new_mapping_size, max_size);
+}
+
+allocation mmap_allocator::reallocate(
+	allocation const allocation,
+	size_t const min_size,
+	size_t const max_size) const noexcept
+{
+	if (allocation.size >= min_mapping_size && min_size >= min_mapping_size)
+	{
+		size_t const old_mapping_size = get_mapping_size(allocation);
+		size_t const new_mapping_size = _mmap_allocator_mapping_size(min_size);
+
+		if (new_mapping_size < min_size)
+		{
+			return vsm::allocation(nullptr);
+		}
+
+		size_t const old_granularity = _mmap_allocator_granularity(allocation.size);
+		size_t const new_granularity = _mmap_allocator_granularity(min_size);
+
+		// Remapping keeps the page size of the old mapping. A block growing out of normal pages
+		// is mapped anew and its contents copied, such that it may use huge pages. Gigantic pages
+		// are only available from the reserved hugetlbfs pool, so a huge page block growing into
+		// gigantic page granularity is only copied if the pool can satisfy the new mapping.
+		// Otherwise the new mapping would use the same page size and the block is remapped.
+		bool remap = new_granularity <= old_granularity;
+
+		if (!remap && old_granularity >= _mmap_allocator_huge_page_size)
+		{
+			if (void* const storage = map_pages(new_mapping_size, MAP_HUGETLB | MAP_HUGE_1GB))
+			{
+				std::memcpy(storage, allocation.storage, allocation.size);
+				deallocate(allocation);
+
+				return vsm::allocation(storage, std::min(new_mapping_size, max_size));
+			}
+
+			remap = true;
+		}
+
+		if (remap)
+		{
+			// The new block must be aligned as expected by get_mapping_size for its new size.
+			size_t const alignment = std::min(
+				_mmap_allocator_granularity(new_mapping_size),
+				_mmap_allocator_huge_page_size);
+
+			void* const storage = remap_aligned(
+				allocation.storage,
+				old_mapping_size,
+				new_mapping_size,
+				alignment);
+
+			if (storage != nullptr)
+			{
+				return vsm::allocation(storage, std::min(new_mapping_size, max_size));
+			}
+
+			// Mappings of explicit huge pages cannot always be remapped. Fall back to copying.
+		}
+	}
+
+	auto const new_allocation = allocate(min_size, max_size);
+
+	if (new_allocation.storage != nullptr)
+	{
+		std::memcpy(
+			new_allocation.storage,
+			allocation.storage,
+			std::min(allocation.size, new_allocation.size));
+
+		deallocate(allocation);
+	}
+
+	return new_allocation;
+}
@@ -0,0 +1,125 @@
+#include <vsm/mmap_allocator.hpp>
+
+#include <algorithm>
+#include <new>
+
+#include <cstring>
+
+#include <Windows.h>
+
+using namespace vsm;
+using namespace vsm::detail;
+
+// Returns zero if the processor does not support large pages.
+static size_t get_large_page_size() noexcept
+{
+	static size_t const large_page_size = GetLargePageMinimum();
+	return large_page_size;
+}
+
+static void* map(size_t const size) noexcept
+{
+	if (_mmap_allocator_granularity(size) >= _mmap_allocator_huge_page_size)
+	{
+		size_t const large_page_size = get_large_page_size();
+
+		// Large page allocations fail unless the process holds SeLockMemoryPrivilege.
+		if (large_page_size != 0 && size % large_page_size == 0)
+		{
+			if (void* const storage = VirtualAlloc(
+				nullptr,
+				size,
+				MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+				PAGE_READWRITE))
+			{
+				return storage;
+			}
+		}
+	}
+
+	return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+
+allocation mmap_allocator::allocate(size_t const min_size, size_t const max_size) const noexcept
+{
+	if (min_size < min_mapping_size)
+	{
+		return allocation(::operator new(min_size, std::nothrow), min_size);
+	}
+
+	size_t const mapping_size = _mmap_allocator_mapping_size(min_size);
+
+	if (mapping_size < min_size)
+	{
+		return allocation(nullptr);
+	}
+
+	void* const storage = map(mapping_size);
+
+	if (storage == nullptr)
+	{
+		return allocation(nullptr);
+	}
+
+	return allocation(storage, std::min(mapping_size, max_size));
+}
+
+void mmap_allocator::deallocate(allocation const allocation) const noexcept
+{
+	if (allocation.size < min_mapping_size)
+	{
+		::operator delete(allocation.storage, allocation.size);
+	}
+	else
+	{
+		VirtualFree(allocation.storage, 0, MEM_RELEASE);
+	}
+}
+
+size_t mmap_allocator::resize(
+	allocation const allocation,
+	size_t const min_size,
+	size_t const max_size) const noexcept
+{
+	if (allocation.size < min_mapping_size || min_size < min_mapping_size)
+	{
+		return 0;
+	}
+
+	// Windows provides no way of extending an allocation in place, so the block can only be
+	// resized within the pages already committed for it.
+	size_t const mapping_size = _mmap_allocator_mapping_size(allocation.size);
+
+	if (_mmap_allocator_mapping_size(min_size) != mapping_size)
+	{
+		return 0;
+	}
+
+	return std::min(mapping_size, max_size);
+}
+
+allocation mmap_allocator::reallocate(
+	allocation const allocation,
+	size_t const min_size,
+	size_t const max_size) const noexcept
+{
+	if (size_t const new_size = resize(allocation, min_size, max_size))
+	{
+		return vsm::allocation(allocation.storage, new_size);
+	}
+
+	auto const new_allocation = allocate(min_size, max_size);
+
+	if (new_allocation.storage != nullptr)
+	{
+		std::memcpy(
+			new_allocation.storage,
+			allocation.storage,
+			std::min(allocation.size, new_allocation.size));
+
+		deallocate(allocation);
+	}
+
+	return new_allocation;
+}
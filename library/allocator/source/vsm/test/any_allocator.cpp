@@ -4,6 +4,8 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <cstring>
+
 using namespace vsm;
 
 namespace {
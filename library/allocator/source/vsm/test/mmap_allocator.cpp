@@ -0,0 +1,304 @@
+#include <vsm/mmap_allocator.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+
+#if vsm_os_linux
+#	include <fstream>
+
+#	include <sys/mman.h>
+#endif
+
+using namespace vsm;
+
+namespace {
+
+static_assert(allocator<mmap_allocator>);
+static_assert(allocators::has_resize_v<mmap_allocator>);
+static_assert(allocators::has_reallocate_v<mmap_allocator>);
+static_assert(allocators::is_always_equal_v<mmap_allocator>);
+
+static constexpr size_t mb = 1024 * 1024;
+static constexpr size_t gb = 1024 * mb;
+
+static_assert(detail::_mmap_allocator_mapping_size(100'000) == 102'400);
+static_assert(detail::_mmap_allocator_mapping_size(16 * mb - 1) == 16 * mb);
+static_assert(detail::_mmap_allocator_mapping_size(16 * mb + 1) == 18 * mb);
+
+static void fill(allocation const allocation, unsigned char const value)
+{
+	std::memset(allocation.storage, value, allocation.size);
+}
+
+static bool is_filled(void const* const storage, size_t const size, unsigned char const value)
+{
+	auto const bytes = static_cast<unsigned char const*>(storage);
+	for (size_t i = 0; i < size; ++i)
+	{
+		if (bytes[i] != value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("mmap_allocator small allocation", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	auto const allocation = allocator.allocate(100, 1000);
+	REQUIRE(allocation.storage != nullptr);
+	REQUIRE(allocation.size == 100);
+	fill(allocation, 1);
+
+	CHECK(allocator.resize(allocation, 200, 200) == 0);
+	allocator.deallocate(allocation);
+}
+
+TEST_CASE("mmap_allocator large allocation", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	auto allocation = allocator.allocate(mb + 1, static_cast<size_t>(-1));
+	REQUIRE(allocation.storage != nullptr);
+	REQUIRE(allocation.size >= mb + 1);
+	CHECK(allocation.size % 4096 == 0);
+	fill(allocation, 1);
+
+	// Resizing within the same pages always succeeds.
+	CHECK(allocator.resize(allocation, mb + 2, static_cast<size_t>(-1)) == allocation.size);
+
+	if (size_t const new_size = allocator.resize(allocation, 4 * mb, 4 * mb))
+	{
+		CHECK(new_size == 4 * mb);
+		CHECK(is_filled(allocation.storage, allocation.size, 1));
+
+		allocation.size = new_size;
+		fill(allocation, 2);
+	}
+
+	if (size_t const new_size = allocator.resize(allocation, mb, mb))
+	{
+		CHECK(new_size == mb);
+		allocation.size = new_size;
+	}
+
+	// Blocks growing large enough for huge pages are not resized in place.
+	CHECK(allocator.resize(allocation, 20 * mb, 20 * mb) == 0);
+
+	CHECK(allocator.resize(allocation, 1000, 1000) == 0);
+	allocator.deallocate(allocation);
+}
+
+TEST_CASE("mmap_allocator huge page allocation", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	auto const allocation = allocator.allocate(20 * mb, 20 * mb);
+	REQUIRE(allocation.storage != nullptr);
+	REQUIRE(allocation.size == 20 * mb);
+
+	// Both explicit and transparent huge page mappings are aligned to the huge page size.
+#if vsm_os_linux
+	CHECK(reinterpret_cast<uintptr_t>(allocation.storage) % (2 * mb) == 0);
+#endif
+
+	fill(allocation, 3);
+	CHECK(is_filled(allocation.storage, allocation.size, 3));
+
+	allocator.deallocate(allocation);
+}
+
+TEST_CASE("mmap_allocator element sized deallocation", "[allocator][mmap_allocator]")
+{
+	// A container of elements larger than a page passes back the size of the elements fitting
+	// within the block, which may be up to a whole element smaller than the block itself.
+	for (size_t const element_size : { size_t(5000), size_t(4096 * 3 + 1), size_t(mb + 3) })
+	{
+		for (size_t count = 1; count * element_size <= 40 * mb; count = count * 3 / 2 + 1)
+		{
+			size_t const min_size = count * element_size;
+			size_t const mapping_size = detail::_mmap_allocator_mapping_size(min_size);
+			size_t const elements_size = mapping_size / element_size * element_size;
+
+			CHECK(detail::_mmap_allocator_mapping_size(elements_size) == mapping_size);
+		}
+	}
+
+	mmap_allocator const allocator;
+
+	// The block is rounded up to the huge page size, leaving most of a huge page after the last
+	// whole element.
+	size_t const element_size = mb + 3;
+	auto const allocation = allocator.allocate(17 * element_size, static_cast<size_t>(-1));
+	REQUIRE(allocation.storage != nullptr);
+	REQUIRE(allocation.size == 18 * mb);
+	fill(allocation, 1);
+
+	allocator.deallocate(vsm::allocation(
+		allocation.storage,
+		allocation.size / element_size * element_size));
+
+#if vsm_os_linux
+	// The last page of the mapping is unmapped as well.
+	auto const last_page = static_cast<unsigned char*>(allocation.storage) + allocation.size - 4096;
+	CHECK(msync(last_page, 4096, MS_ASYNC) == -1);
+#endif
+}
+
+TEST_CASE("mmap_allocator reallocate", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	auto allocation = allocator.allocate(1000, 1000);
+	REQUIRE(allocation.storage != nullptr);
+	fill(allocation, 1);
+
+	// Small to large: the contents are copied into a new mapping.
+	auto new_allocation = allocator.reallocate(allocation, 2 * mb, 2 * mb);
+	REQUIRE(new_allocation.storage != nullptr);
+	REQUIRE(new_allocation.size == 2 * mb);
+	CHECK(is_filled(new_allocation.storage, 1000, 1));
+
+	allocation = new_allocation;
+	fill(allocation, 2);
+
+	// Large to huge: the contents are copied into a new mapping using huge pages.
+	new_allocation = allocator.reallocate(allocation, 64 * mb, static_cast<size_t>(-1));
+	REQUIRE(new_allocation.storage != nullptr);
+	REQUIRE(new_allocation.size >= 64 * mb);
+	CHECK(is_filled(new_allocation.storage, 2 * mb, 2));
+#if vsm_os_linux
+	CHECK(reinterpret_cast<uintptr_t>(new_allocation.storage) % (2 * mb) == 0);
+#endif
+
+	allocation = new_allocation;
+	fill(allocation, 3);
+
+	// Huge to larger: the pages are moved using mremap.
+	new_allocation = allocator.reallocate(allocation, 128 * mb, static_cast<size_t>(-1));
+	REQUIRE(new_allocation.storage != nullptr);
+	REQUIRE(new_allocation.size >= 128 * mb);
+	CHECK(is_filled(new_allocation.storage, 64 * mb, 3));
+#if vsm_os_linux
+	CHECK(reinterpret_cast<uintptr_t>(new_allocation.storage) % (2 * mb) == 0);
+#endif
+
+	allocation = new_allocation;
+	fill(allocation, 3);
+
+	// Large to small: the contents are truncated.
+	new_allocation = allocator.reallocate(allocation, 100, 100);
+	REQUIRE(new_allocation.storage != nullptr);
+	REQUIRE(new_allocation.size == 100);
+	CHECK(is_filled(new_allocation.storage, 100, 3));
+
+	allocator.deallocate(new_allocation);
+}
+
+TEST_CASE("mmap_allocator reallocate keeps huge page alignment", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	// The mapping size of a block just below the huge page threshold rounds up into huge page
+	// granularity, requiring huge page alignment.
+	auto allocation = allocator.allocate(8 * mb, 8 * mb);
+	REQUIRE(allocation.storage != nullptr);
+	fill(allocation, 1);
+
+	auto new_allocation = allocator.reallocate(allocation, 16 * mb - 1, static_cast<size_t>(-1));
+	REQUIRE(new_allocation.storage != nullptr);
+	REQUIRE(new_allocation.size == 16 * mb);
+	CHECK(is_filled(new_allocation.storage, 8 * mb, 1));
+#if vsm_os_linux
+	CHECK(reinterpret_cast<uintptr_t>(new_allocation.storage) % (2 * mb) == 0);
+#endif
+
+	// Growing a huge page block remaps it, possibly moving it.
+	allocation = new_allocation;
+	for (size_t size = 32 * mb; size <= 256 * mb; size *= 2)
+	{
+		fill(allocation, 2);
+
+		new_allocation = allocator.reallocate(allocation, size, size);
+		REQUIRE(new_allocation.storage != nullptr);
+		REQUIRE(new_allocation.size == size);
+		CHECK(is_filled(new_allocation.storage, size / 2, 2));
+#if vsm_os_linux
+		CHECK(reinterpret_cast<uintptr_t>(new_allocation.storage) % (2 * mb) == 0);
+#endif
+
+		allocation = new_allocation;
+	}
+
+	allocator.deallocate(allocation);
+}
+
+#if vsm_os_linux
+static bool is_resident(void const* const page)
+{
+	unsigned char status = 0;
+	return mincore(const_cast<void*>(page), 4096, &status) == 0 && (status & 1) != 0;
+}
+
+static size_t get_free_gigantic_page_count()
+{
+	std::ifstream stream("/sys/kernel/mm/hugepages/hugepages-1048576kB/free_hugepages");
+
+	size_t count = 0;
+	stream >> count;
+	return count;
+}
+
+TEST_CASE("mmap_allocator reallocate into gigantic page granularity", "[allocator][mmap_allocator]")
+{
+	mmap_allocator const allocator;
+
+	size_t const old_size = 8 * gb - 2 * mb;
+	size_t const new_size = 8 * gb;
+
+	static_assert(detail::_mmap_allocator_granularity(old_size) == 2 * mb);
+	static_assert(detail::_mmap_allocator_granularity(new_size) == gb);
+
+	// The system may not be able to commit this much memory.
+	auto const allocation = allocator.allocate(old_size, old_size);
+	if (allocation.storage == nullptr)
+	{
+		return;
+	}
+	REQUIRE(allocation.size == old_size);
+
+	// Only the first and last pages are touched.
+	auto const old_storage = static_cast<unsigned char*>(allocation.storage);
+	std::memset(old_storage, 1, 4096);
+	std::memset(old_storage + old_size - 4096, 2, 4096);
+
+	bool const has_gigantic_pages = get_free_gigantic_page_count() >= new_size / gb;
+
+	auto const new_allocation = allocator.reallocate(allocation, new_size, new_size);
+	if (new_allocation.storage == nullptr)
+	{
+		allocator.deallocate(allocation);
+		return;
+	}
+	REQUIRE(new_allocation.size == new_size);
+	CHECK(reinterpret_cast<uintptr_t>(new_allocation.storage) % (2 * mb) == 0);
+
+	auto const new_storage = static_cast<unsigned char*>(new_allocation.storage);
+	CHECK(is_filled(new_storage, 4096, 1));
+	CHECK(is_filled(new_storage + old_size - 4096, 4096, 2));
+
+	// Without gigantic pages for the new block, the block keeps its address or is remapped
+	// instead of being copied, leaving the untouched pages in the middle of the block unpopulated.
+	if (!has_gigantic_pages)
+	{
+		CHECK(!is_resident(new_storage + 4 * gb));
+	}
+
+	allocator.deallocate(new_allocation);
+}
+#endif
+
+} // namespace
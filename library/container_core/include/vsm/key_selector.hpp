@@ -37,7 +37,7 @@ concept tuple_like = requires
 
 
 template<typename T, size_t... Is>
-auto make_key_tuple(T const& tuple, std::index_sequence<Is...>)
+constexpr auto make_key_tuple(T const& tuple, std::index_sequence<Is...>)
 {
 	return std::tuple<std::tuple_element_t<Is, T> const&...>(get<Is>(tuple)...);
 }
@@ -63,39 +63,44 @@ struct select_key_cpo
 struct normalize_key_cpo
 {
 	template<typename... Ts>
-	friend std::tuple<Ts...> const& tag_invoke(normalize_key_cpo, std::tuple<Ts...> const& tuple)
+	friend constexpr std::tuple<Ts...> const& tag_invoke(
+		normalize_key_cpo,
+		std::tuple<Ts...> const& tuple)
 	{
 		return tuple;
 	}
 
 	template<tuple_like T>
-	friend auto tag_invoke(normalize_key_cpo, T const& tuple)
+	friend constexpr auto tag_invoke(normalize_key_cpo, T const& tuple)
 	{
 		return detail::make_key_tuple(tuple, std::make_index_sequence<std::tuple_size_v<T>>());
 	}
 
 
 	template<typename T, size_t Size>
-	friend array_view<T> tag_invoke(normalize_key_cpo, T const(&array)[Size])
+	friend constexpr array_view<T> tag_invoke(normalize_key_cpo, T const(&array)[Size])
 	{
 		return array_view<T>(array);
 	}
 
 	template<character T, size_t Size>
-	friend std::basic_string_view<T> tag_invoke(normalize_key_cpo, T const(&array)[Size])
+	friend constexpr std::basic_string_view<T> tag_invoke(
+		normalize_key_cpo,
+		T const(&array)[Size])
 	{
 		return std::basic_string_view<T>(array);
 	}
 
 
 	template<typename T>
-	friend T const& tag_invoke(normalize_key_cpo, T const& key)
+	friend constexpr T const& tag_invoke(normalize_key_cpo, T const& key)
 	{
 		return key;
 	}
 
 	template<typename T>
-	[[nodiscard]] vsm_static_operator decltype(auto) operator()(T const& key) vsm_static_operator_const noexcept
+	[[nodiscard]] vsm_static_operator constexpr decltype(auto) operator()(
+		T const& key) vsm_static_operator_const noexcept
 		requires tag_invocable<normalize_key_cpo, T const&>
 	{
 		return tag_invoke(normalize_key_cpo(), key);
@@ -52,6 +52,19 @@ inline constexpr bool _allocator_has_resize = requires (T& t, size_t const& s, a
 	{ t.resize(a, s, s) } noexcept -> std::same_as<size_t>;
 };
 
+// On success, the contents of the old block are moved to the returned block, which may be at a
+// different address, and the old block is deallocated. On failure, a null allocation is returned
+// and the old block is left unchanged.
+template<typename T>
+inline constexpr bool _allocator_has_reallocate = requires (
+	T& t,
+	size_t const& s,
+	allocation const& a)
+{
+	// allocation reallocate(allocation allocation, size_t min_size, size_t max_size) /* const */;
+	{ t.reallocate(a, s, s) } noexcept -> std::same_as<allocation>;
+};
+
 template<typename T>
 consteval bool _allocator_is_always_equal()
 {
@@ -134,6 +147,9 @@ namespace allocators {
 template<memory_resource T>
 inline constexpr bool has_resize_v = detail::_allocator_has_resize<T const>;
 
+template<memory_resource T>
+inline constexpr bool has_reallocate_v = detail::_allocator_has_reallocate<T const>;
+
 
 template<allocator T>
 inline constexpr bool is_always_equal_v = detail::_allocator_is_always_equal<T>();
@@ -177,6 +193,25 @@ template<memory_resource Allocator>
 	}
 }
 
+template<memory_resource Allocator>
+[[nodiscard]] constexpr allocation reallocate(
+	Allocator&& allocator,
+	allocation const allocation,
+	size_t const min_size,
+	size_t const max_size)
+{
+	vsm_assert(min_size <= max_size);
+
+	if constexpr (has_reallocate_v<Allocator>)
+	{
+		return allocator.reallocate(allocation, min_size, max_size);
+	}
+	else
+	{
+		return vsm::allocation(nullptr);
+	}
+}
+
 
 template<typename MemoryResource>
 using position_type_or_void = decltype(detail::_allocator_position_type<MemoryResource>(0));
@@ -339,6 +374,15 @@ public:
 		return m_memory_resource->resize(allocation, min_size, max_size);
 	}
 
+	[[nodiscard]] vsm::allocation reallocate(
+		vsm::allocation const allocation,
+		size_t const min_size,
+		size_t const max_size) const noexcept
+		requires allocators::has_reallocate_v<MemoryResource>
+	{
+		return m_memory_resource->reallocate(allocation, min_size, max_size);
+	}
+
 	template<typename MR = MemoryResource>
 		requires monotonic_memory_resource<MemoryResource>
 	[[nodiscard]] typename MR::position_type get_position() const noexcept
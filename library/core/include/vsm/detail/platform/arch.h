@@ -4,6 +4,18 @@
 #	define vsm_arch_x86 0
 #endif
 
+#ifndef vsm_arch_x86_avx2
+#	define vsm_arch_x86_avx2 0
+#endif
+
+#ifndef vsm_arch_x86_avx512bw
+#	define vsm_arch_x86_avx512bw 0
+#endif
+
+#ifndef vsm_arch_x86_avx512dq
+#	define vsm_arch_x86_avx512dq 0
+#endif
+
 #ifndef vsm_word_32
 #	define vsm_word_32 0
 #endif
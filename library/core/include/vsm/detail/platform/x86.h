@@ -5,3 +5,19 @@
 #else
 #	error x86 intrinsics header not found
 #endif
+
+// NOLINTBEGIN(modernize-macro-to-enum)
+
+#if defined(__AVX2__)
+#	define vsm_arch_x86_avx2 1
+#endif
+
+#if defined(__AVX512BW__)
+#	define vsm_arch_x86_avx512bw 1
+#endif
+
+#if defined(__AVX512DQ__)
+#	define vsm_arch_x86_avx512dq 1
+#endif
+
+// NOLINTEND(modernize-macro-to-enum)
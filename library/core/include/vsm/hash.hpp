@@ -1,11 +1,13 @@
 #pragma once
 
+#include <vsm/assert.h>
 #include <vsm/concepts.hpp>
 #include <vsm/standard.hpp>
 #include <vsm/tag_invoke.hpp>
 #include <vsm/type_traits.hpp>
 
 #include <bit>
+#include <span>
 #include <tuple>
 
 #include <cstddef>
@@ -68,14 +70,16 @@ struct hash_append_bits_cpo
 	}
 
 	template<typename State, typename T>
-	vsm_static_operator void operator()(State& state, T const& value) vsm_static_operator_const
+	vsm_static_operator constexpr void operator()(
+		State& state,
+		T const& value) vsm_static_operator_const
 		requires tag_invocable<hash_append_bits_cpo, State&, T const&>
 	{
 		tag_invoke(hash_append_bits_cpo(), state, value);
 	}
 
 	template<typename State>
-	vsm_static_operator void operator()(
+	vsm_static_operator constexpr void operator()(
 		State& state,
 		void const* const data,
 		size_t const size) vsm_static_operator_const
@@ -88,18 +92,38 @@ static constexpr hash_append_bits_cpo hash_append_bits = {};
 
 
 template<typename State, typename... Ts, size_t... Is>
-void hash_append_tuple(State& state, std::tuple<Ts...> const& tuple, std::index_sequence<Is...>);
+constexpr void hash_append_tuple(
+	State& state,
+	std::tuple<Ts...> const& tuple,
+	std::index_sequence<Is...>);
+
+// Used to detect hash_append customizations, including those provided by a hash policy, which is an
+// associated class of this state. The generic overloads for integers, pointers, arrays and ranges
+// are disabled for this state, so any remaining overload found for such a type is a customization.
+template<typename Policy>
+struct hash_append_probe_state {};
+
+template<typename State>
+inline constexpr bool is_hash_append_probe_state_v = false;
+
+template<typename Policy>
+inline constexpr bool is_hash_append_probe_state_v<hash_append_probe_state<Policy>> = true;
 
 struct hash_append_cpo
 {
 	template<typename State>
-	friend void tag_invoke(hash_append_cpo, State& state, std::same_as<bool> auto const value)
+		requires (!is_hash_append_probe_state_v<State>)
+	friend constexpr void tag_invoke(
+		hash_append_cpo,
+		State& state,
+		std::same_as<bool> auto const value)
 	{
 		hash_append_bits(state, static_cast<unsigned char>(value));
 	}
 
 	template<typename State, std::integral T>
-	friend void tag_invoke(hash_append_cpo, State& state, T const value)
+		requires (!is_hash_append_probe_state_v<State>)
+	friend constexpr void tag_invoke(hash_append_cpo, State& state, T const value)
 	{
 		// C++ requires two's complement, so we might as well convert the integer to its unsigned
 		// counterpart which has the same bit representation. This reduces the number of template
@@ -119,12 +143,14 @@ struct hash_append_cpo
 	}
 
 	template<typename State, typename T, size_t Size>
-	friend void tag_invoke(hash_append_cpo, State& state, T const(& array)[Size])
+		requires (!is_hash_append_probe_state_v<State>)
+	friend constexpr void tag_invoke(hash_append_cpo, State& state, T const(& array)[Size])
 	{
 		hash_append_cpo()(state, static_cast<T const*>(array), static_cast<T const*>(array) + Size);
 	}
 
 	template<typename State, object_pointer Pointer>
+		requires (!is_hash_append_probe_state_v<State>)
 	friend void tag_invoke(hash_append_cpo, State& state, Pointer const ptr)
 	{
 		auto const value = reinterpret_cast<uintptr_t>(ptr);
@@ -133,20 +159,23 @@ struct hash_append_cpo
 	}
 
 	template<typename State, std::ranges::range Range>
-	friend void tag_invoke(hash_append_cpo, State& state, Range const& range)
+		requires (!is_hash_append_probe_state_v<State>)
+	friend constexpr void tag_invoke(hash_append_cpo, State& state, Range const& range)
 	{
 		hash_append_cpo()(state, std::ranges::begin(range), std::ranges::end(range));
 	}
 
 	template<typename State, hash_appendable_to<State>... Ts>
-	friend void tag_invoke(hash_append_cpo, State& state, std::tuple<Ts...> const& tuple)
+	friend constexpr void tag_invoke(hash_append_cpo, State& state, std::tuple<Ts...> const& tuple)
 	{
 		detail::hash_append_tuple(state, tuple, std::index_sequence_for<Ts...>());
 	}
 
 	template<typename State, non_cvref T>
 		requires hash_appendable_to<T, State>
-	vsm_static_operator void operator()(State& state, T const& value) vsm_static_operator_const
+	vsm_static_operator constexpr void operator()(
+		State& state,
+		T const& value) vsm_static_operator_const
 	{
 		if constexpr (tag_invocable<hash_append_cpo, State&, T const&>)
 		{
@@ -164,7 +193,7 @@ struct hash_append_cpo
 
 	template<typename State, std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
 		requires hash_appendable_to<std::iter_value_t<Iterator>, State>
-	vsm_static_operator void operator()(
+	vsm_static_operator constexpr void operator()(
 		State& state,
 		Iterator begin,
 		Sentinel end) vsm_static_operator_const
@@ -180,12 +209,24 @@ struct hash_append_cpo
 			std::contiguous_iterator<Iterator> &&
 			std::sized_sentinel_for<Sentinel, Iterator>)
 		{
-			std::same_as<value_type> auto const* const data = std::to_address(begin);
+			// The object representation of the elements is not accessible in constant expressions,
+			// so there the elements are appended one at a time instead.
+			vsm_if_consteval
+			{
+				for (; begin != end; ++begin)
+				{
+					operator()(state, *begin);
+				}
+			}
+			else
+			{
+				std::same_as<value_type> auto const* const data = std::to_address(begin);
 
-			hash_append_bits(
-				state,
-				reinterpret_cast<void const*>(data),
-				static_cast<size_t>(end - begin) * sizeof(value_type));
+				hash_append_bits(
+					state,
+					reinterpret_cast<void const*>(data),
+					static_cast<size_t>(end - begin) * sizeof(value_type));
+			}
 		}
 		else
 		{
@@ -199,11 +240,60 @@ struct hash_append_cpo
 static constexpr hash_append_cpo hash_append = {};
 
 template<typename State, typename... Ts, size_t... Is>
-void hash_append_tuple(State& state, std::tuple<Ts...> const& tuple, std::index_sequence<Is...>)
+constexpr void hash_append_tuple(
+	State& state,
+	std::tuple<Ts...> const& tuple,
+	std::index_sequence<Is...>)
 {
 	(detail::hash_append(state, std::get<Is>(tuple)), ...);
 }
 
+
+// Integers for which the policy provides no hash_append customization. These are hash appended as
+// their object representation of at most 64 bits, so hashes providing hash_word may hash them in
+// one shot without constructing a streaming state.
+template<typename T, typename Policy>
+concept single_word_hashable =
+	std::integral<T> &&
+	sizeof(T) <= sizeof(uint64_t) &&
+	!tag_invocable<hash_append_cpo, hash_append_probe_state<Policy>&, T const&>;
+
+// Object pointers for which the policy provides no hash_append customization.
+template<typename T, typename Policy>
+concept pointer_hashable =
+	object_pointer<T> &&
+	!tag_invocable<hash_append_cpo, hash_append_probe_state<Policy>&, T const&>;
+
+// Ranges for which neither the type nor the policy provides a hash_append customization. These are
+// hash appended as the object representation of their contiguous elements, so hashes providing
+// hash_bytes may hash them in one shot without constructing a streaming state.
+template<typename T, typename Policy>
+concept contiguous_bytes_hashable =
+	std::ranges::contiguous_range<T const> &&
+	std::ranges::sized_range<T const> &&
+	is_trivially_hashable_v<std::ranges::range_value_t<T const>> &&
+	!tag_invocable<hash_append_cpo, hash_append_probe_state<Policy>&, T const&>;
+
+// The one-shot functions of a hash must produce the same values as appending the same object
+// representation to a new state of that hash.
+template<typename Hash>
+concept one_shot_bytes_hash = requires (size_t const seed, void const* const data, size_t const n)
+{
+	{ Hash::hash_bytes(seed, data, n) } -> std::same_as<size_t>;
+};
+
+template<typename Hash>
+concept one_shot_word_hash = requires (size_t const seed, uint64_t const word, size_t const size)
+{
+	{ Hash::hash_word(seed, word, size) } -> std::same_as<size_t>;
+};
+
+template<typename Hash, typename T>
+concept batch_word_hash = requires (size_t const seed, T const* const words, size_t* const hashes)
+{
+	Hash::hash_words(seed, words, hashes, size_t());
+};
+
 } // namespace detail
 
 using detail::is_trivially_hashable_v;
@@ -221,6 +311,26 @@ using detail::hash_append;
 
 struct default_hash_policy {};
 
+// Hashers using this policy are not seeded by the address space layout of the process, so their
+// hashes are stable across processes. Custom policies may derive from this policy.
+struct stable_hash_policy
+{
+	static constexpr size_t seed = 0;
+};
+
+template<typename Policy>
+[[nodiscard]] constexpr size_t get_hash_seed()
+{
+	if constexpr (requires { { Policy::seed } -> std::convertible_to<size_t>; })
+	{
+		return Policy::seed;
+	}
+	else
+	{
+		return get_aslr_seed();
+	}
+}
+
 template<typename Hash, typename Policy>
 struct basic_hasher_state : Hash::state_type {};
 
@@ -230,9 +340,53 @@ struct basic_hasher
 	template<hash_appendable_to<basic_hasher_state<Hash, Policy>> T>
 	vsm_static_operator constexpr size_t operator()(T const& value) vsm_static_operator_const
 	{
-		basic_hasher_state<Hash, Policy> state = { Hash::initialize(get_aslr_seed()) };
-		vsm::hash_append(state, value);
-		return Hash::finalize(static_cast<typename Hash::state_type const&>(state));
+		// The one-shot hashes produce the same values as appending the value to a streaming state.
+		if constexpr (detail::single_word_hashable<T, Policy> && detail::one_shot_word_hash<Hash>)
+		{
+			return Hash::hash_word(get_hash_seed<Policy>(), static_cast<uint64_t>(value), sizeof(T));
+		}
+		else if constexpr (detail::pointer_hashable<T, Policy> && detail::one_shot_bytes_hash<Hash>)
+		{
+			// Pointers are hash appended twice, as by the hash_append overload for pointers.
+			auto const address = reinterpret_cast<uintptr_t>(value);
+			uintptr_t const data[2] = { address, address };
+			return Hash::hash_bytes(get_hash_seed<Policy>(), data, sizeof(data));
+		}
+		else if constexpr (
+			detail::contiguous_bytes_hashable<T, Policy> &&
+			detail::one_shot_bytes_hash<Hash>)
+		{
+			return Hash::hash_bytes(
+				get_hash_seed<Policy>(),
+				reinterpret_cast<void const*>(std::ranges::data(value)),
+				std::ranges::size(value) * sizeof(std::ranges::range_value_t<T const>));
+		}
+		else
+		{
+			basic_hasher_state<Hash, Policy> state = { Hash::initialize(get_hash_seed<Policy>()) };
+			vsm::hash_append(state, value);
+			return Hash::finalize(static_cast<typename Hash::state_type const&>(state));
+		}
+	}
+
+	// Computes the hash of each value, such that hashes[i] == basic_hasher()(values[i]).
+	// Hashes providing hash_words may compute the hashes of single word values in parallel.
+	template<hash_appendable_to<basic_hasher_state<Hash, Policy>> T>
+	static void hash_many(std::span<T const> const values, std::span<size_t> const hashes)
+	{
+		vsm_assert(values.size() == hashes.size());
+
+		if constexpr (detail::single_word_hashable<T, Policy> && detail::batch_word_hash<Hash, T>)
+		{
+			Hash::hash_words(get_hash_seed<Policy>(), values.data(), hashes.data(), values.size());
+		}
+		else
+		{
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				hashes[i] = basic_hasher()(values[i]);
+			}
+		}
 	}
 };
 
@@ -338,7 +338,7 @@ std::pair<SourceIterator, OutputIterator> uninitialized_relocate_n(
 		{
 			vsm_clang_diagnostic(push)
 			vsm_clang_diagnostic(ignored "-Wfor-loop-analysis")
-			for (; c_n > 0; --n, (void)++out_pos)
+			for (; c_n > 0; --n, (void)++src_beg, (void)++out_pos)
 			{
 				if constexpr (use_trivial_copy)
 				{
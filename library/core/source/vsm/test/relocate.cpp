@@ -2,6 +2,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <memory>
+#include <string>
+
 using namespace vsm;
 
 namespace {
@@ -53,4 +56,40 @@ TEST_CASE("relocate", "[core][relocate]")
 	//TODO: Implement relocate unit tests
 }
 
+TEST_CASE("uninitialized_relocate_n relocates non-trivial elements", "[core][relocate]")
+{
+	static constexpr size_t size = 4;
+
+	union storage_type
+	{
+		std::string elements[size];
+
+		storage_type() {}
+		~storage_type() {}
+	};
+
+	storage_type src;
+	storage_type dst;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		::new (&src.elements[i]) std::string(std::to_string(i));
+	}
+
+	auto const [src_end, dst_end] = uninitialized_relocate_n(
+		forward_pointer(src.elements),
+		size,
+		forward_pointer(dst.elements));
+
+	CHECK(src_end == forward_pointer(src.elements + size));
+	CHECK(dst_end == forward_pointer(dst.elements + size));
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		CHECK(dst.elements[i] == std::to_string(i));
+	}
+
+	std::destroy_n(dst.elements, size);
+}
+
 } // namespace
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <vsm/hash.hpp>
+
+#include <new>
+
+#include <cstring>
+
+namespace vsm {
+
+template<typename Hash, size_t BufferSize>
+class buffered_hash_state;
+
+// Adapts a streaming hash such that small appends are collected in a buffer of BufferSize bytes
+// and passed to the underlying hash in larger blocks. The underlying state is only initialized
+// once the buffer overflows, so keys which fit in the buffer are hashed using a single call to the
+// one-shot hash_bytes function of the underlying hash, if it has one.
+//
+// Because the underlying hash is a streaming hash, the produced values are identical to those of
+// the underlying hash itself.
+template<typename Hash, size_t BufferSize = 64>
+class buffered_hash
+{
+	static_assert(BufferSize > 0);
+
+public:
+	using state_type = buffered_hash_state<Hash, BufferSize>;
+
+	static state_type initialize(size_t const seed)
+	{
+		state_type state;
+		state.m_seed = seed;
+		state.m_size = 0;
+		state.m_initialized = false;
+		return state;
+	}
+
+	static size_t finalize(state_type const& state)
+	{
+		if (!state.m_initialized)
+		{
+			if constexpr (detail::one_shot_bytes_hash<Hash>)
+			{
+				return Hash::hash_bytes(state.m_seed, state.m_buffer, state.m_size);
+			}
+			else
+			{
+				typename Hash::state_type inner = Hash::initialize(state.m_seed);
+				hash_append_bits(inner, static_cast<void const*>(state.m_buffer), state.m_size);
+				return Hash::finalize(inner);
+			}
+		}
+
+		if (state.m_size == 0)
+		{
+			return Hash::finalize(state.m_state);
+		}
+
+		typename Hash::state_type inner = state.m_state;
+		hash_append_bits(inner, static_cast<void const*>(state.m_buffer), state.m_size);
+		return Hash::finalize(inner);
+	}
+
+	static size_t hash_bytes(size_t const seed, void const* const data, size_t const size)
+		requires detail::one_shot_bytes_hash<Hash>
+	{
+		return Hash::hash_bytes(seed, data, size);
+	}
+
+	static size_t hash_word(size_t const seed, uint64_t const word, size_t const size)
+		requires detail::one_shot_word_hash<Hash>
+	{
+		return Hash::hash_word(seed, word, size);
+	}
+
+	template<typename T>
+	static void hash_words(
+		size_t const seed,
+		T const* const words,
+		size_t* const hashes,
+		size_t const count)
+		requires detail::batch_word_hash<Hash, T>
+	{
+		Hash::hash_words(seed, words, hashes, count);
+	}
+};
+
+template<typename Hash, size_t BufferSize>
+class buffered_hash_state
+{
+	typename Hash::state_type m_state;
+	size_t m_seed;
+	size_t m_size;
+	bool m_initialized;
+	unsigned char m_buffer[BufferSize];
+
+	static void flush(buffered_hash_state& state, void const* const data, size_t const size)
+	{
+		if (!state.m_initialized)
+		{
+			// Construct the state in place, as it may be large.
+			::new (static_cast<void*>(&state.m_state)) typename Hash::state_type(
+				Hash::initialize(state.m_seed));
+			state.m_initialized = true;
+		}
+
+		if (state.m_size != 0)
+		{
+			hash_append_bits(state.m_state, static_cast<void const*>(state.m_buffer), state.m_size);
+			state.m_size = 0;
+		}
+
+		if (size >= BufferSize)
+		{
+			hash_append_bits(state.m_state, data, size);
+		}
+		else
+		{
+			std::memcpy(state.m_buffer, data, size);
+			state.m_size = size;
+		}
+	}
+
+	vsm_always_inline friend void tag_invoke(
+		decltype(hash_append_bits),
+		buffered_hash_state& state,
+		void const* const data,
+		size_t const size)
+	{
+		if (size <= BufferSize - state.m_size)
+		{
+			if (size != 0)
+			{
+				std::memcpy(state.m_buffer + state.m_size, data, size);
+				state.m_size += size;
+			}
+		}
+		else
+		{
+			flush(state, data, size);
+		}
+	}
+
+	friend class buffered_hash<Hash, BufferSize>;
+};
+
+} // namespace vsm
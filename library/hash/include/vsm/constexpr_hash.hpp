@@ -0,0 +1,143 @@
+#pragma once
+
+#include <vsm/hash.hpp>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include <climits>
+#include <cstdint>
+
+namespace vsm {
+
+// A streaming hash usable in constant expressions, such that hash tables can be built at compile
+// time and queried at run time. The appended bytes are collected into little endian 64-bit words,
+// each of which is mixed into the state using the murmur3 64-bit finalizer. It is cheap to evaluate
+// at compile time, but of lower quality than xxhash.
+//
+// The object representation of a value is not accessible in constant expressions, so integers
+// appended to the state of basic_hasher<constexpr_hash, Policy> are converted to bytes using
+// std::bit_cast instead, and enumerations are appended as their underlying integers. Hashing in
+// constant expressions requires a policy with a constant seed, such as stable_hash_policy, and any
+// hash_append customizations of the hashed types must be constexpr.
+class constexpr_hash
+{
+public:
+	class state_type
+	{
+		uint64_t m_hash = 0;
+		uint64_t m_word = 0;
+		size_t m_size = 0;
+
+		friend class constexpr_hash;
+	};
+
+	[[nodiscard]] static constexpr state_type initialize(size_t const seed) noexcept
+	{
+		state_type state;
+		state.m_hash = 0x9e3779b97f4a7c15 ^ static_cast<uint64_t>(seed);
+		return state;
+	}
+
+	[[nodiscard]] static constexpr size_t finalize(state_type const& state) noexcept
+	{
+		uint64_t hash = state.m_hash;
+
+		if (state.m_size % sizeof(uint64_t) != 0)
+		{
+			hash = mix(hash ^ state.m_word);
+		}
+
+		return static_cast<size_t>(mix(hash ^ static_cast<uint64_t>(state.m_size)));
+	}
+
+	// The murmur3 64-bit finalizer.
+	[[nodiscard]] static constexpr uint64_t mix(uint64_t x) noexcept
+	{
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccd;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53;
+		x ^= x >> 33;
+		return x;
+	}
+
+private:
+	static constexpr void _append(
+		state_type& state,
+		unsigned char const* data,
+		size_t size) noexcept
+	{
+		while (size != 0)
+		{
+			size_t const offset = state.m_size % sizeof(uint64_t);
+
+			if (offset == 0 && size >= sizeof(uint64_t))
+			{
+				// Whole words are mixed in directly while no partial word is buffered.
+				uint64_t word = 0;
+				for (size_t i = 0; i < sizeof(uint64_t); ++i)
+				{
+					word |= static_cast<uint64_t>(data[i]) << i * CHAR_BIT;
+				}
+
+				state.m_hash = mix(state.m_hash ^ word);
+				state.m_size += sizeof(uint64_t);
+				data += sizeof(uint64_t);
+				size -= sizeof(uint64_t);
+			}
+			else
+			{
+				state.m_word |= static_cast<uint64_t>(*data) << offset * CHAR_BIT;
+				state.m_size += 1;
+				data += 1;
+				size -= 1;
+
+				if (offset == sizeof(uint64_t) - 1)
+				{
+					state.m_hash = mix(state.m_hash ^ state.m_word);
+					state.m_word = 0;
+				}
+			}
+		}
+	}
+
+	// More specialized than the generic overload reading the object representation of the value.
+	template<typename Policy, std::integral T>
+	friend constexpr void tag_invoke(
+		decltype(hash_append_bits),
+		basic_hasher_state<constexpr_hash, Policy>& state,
+		T const& value) noexcept
+	{
+		auto const bytes = std::bit_cast<std::array<unsigned char, sizeof(T)>>(value);
+		_append(state, bytes.data(), bytes.size());
+	}
+
+	template<typename Policy, typename T>
+		requires std::is_enum_v<T>
+	friend constexpr void tag_invoke(
+		decltype(hash_append),
+		basic_hasher_state<constexpr_hash, Policy>& state,
+		T const value) noexcept
+	{
+		hash_append(state, std::to_underlying(value));
+	}
+
+	friend void tag_invoke(
+		decltype(hash_append_bits),
+		state_type& state,
+		void const* const data,
+		size_t const size) noexcept
+	{
+		_append(state, static_cast<unsigned char const*>(data), size);
+	}
+};
+
+// A hasher usable in constant expressions. Unlike default_hasher it is not seeded, so its hashes
+// are also stable across processes.
+using constexpr_hasher = basic_hasher<constexpr_hash, stable_hash_policy>;
+
+} // namespace vsm
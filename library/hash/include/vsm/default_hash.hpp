@@ -1,14 +1,27 @@
 #pragma once
 
+#include <vsm/buffered_hash.hpp>
+#include <vsm/xxh3.hpp>
 #include <vsm/xxhash.hpp>
 
+// Selects XXH3 instead of the classic word sized xxHash as the default hash. Note that this changes
+// the values produced by stable_hasher.
+#ifndef vsm_config_default_hash_xxh3
+#	define vsm_config_default_hash_xxh3 0
+#endif
+
 namespace vsm {
 
-using default_hash = xxhash;
+#if vsm_config_default_hash_xxh3
+using default_hash = buffered_hash<xxh3>;
+#else
+using default_hash = buffered_hash<xxhash>;
+#endif
 
 template<typename Policy>
 using basic_default_hasher = basic_hasher<default_hash, Policy>;
 
 using default_hasher = basic_default_hasher<default_hash_policy>;
+using stable_hasher = basic_default_hasher<stable_hash_policy>;
 
 } // namespace vsm
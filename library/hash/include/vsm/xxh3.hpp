@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vsm/hash.hpp>
+
+// TODO: This should be defined by the xxhash package.
+#define XXH_STATIC_LINKING_ONLY // NOLINT(readability-identifier-naming)
+
+#include <xxhash.h>
+
+#include <bit>
+#include <cstdint>
+
+namespace vsm {
+
+class xxh3
+{
+public:
+	struct state_type : XXH3_state_t {};
+
+	static state_type initialize(size_t const seed)
+	{
+		state_type state;
+		XXH3_INITSTATE(&state);
+		XXH3_64bits_reset_withSeed(&state, seed);
+		return state;
+	}
+
+	static size_t finalize(state_type const& state)
+	{
+		return static_cast<size_t>(XXH3_64bits_digest(&state));
+	}
+
+	// One-shot hash of a contiguous buffer. Equivalent to appending the buffer to a new state.
+	static size_t hash_bytes(size_t const seed, void const* const data, size_t const size)
+	{
+		return static_cast<size_t>(XXH3_64bits_withSeed(data, size, seed));
+	}
+
+	// One-shot hash of a single integer of the given size in bytes. Equivalent to appending the
+	// object representation of the integer to a new state.
+	static size_t hash_word(size_t const seed, uint64_t const word, size_t const size)
+	{
+		auto const* data = reinterpret_cast<unsigned char const*>(&word);
+		if constexpr (std::endian::native == std::endian::big)
+		{
+			data += sizeof(word) - size;
+		}
+		return hash_bytes(seed, data, size);
+	}
+
+private:
+	vsm_always_inline friend void tag_invoke(
+		decltype(hash_append_bits),
+		state_type& state,
+		void const* const data,
+		size_t const size)
+	{
+		XXH3_64bits_update(&state, data, size);
+	}
+};
+
+} // namespace vsm
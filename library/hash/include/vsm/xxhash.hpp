@@ -1,13 +1,21 @@
 #pragma once
 
 #include <vsm/hash.hpp>
+#include <vsm/platform.h>
 #include <vsm/preprocessor.h>
+#include <vsm/standard/bit.hpp>
 
 // TODO: This should be defined by the xxhash package.
 #define XXH_STATIC_LINKING_ONLY // NOLINT(readability-identifier-naming)
 
 #include <xxhash.h>
 
+#include <bit>
+#include <type_traits>
+
+#include <climits>
+#include <cstdint>
+
 namespace vsm {
 
 #ifdef __INTELLISENSE__
@@ -35,7 +43,229 @@ public:
 		return vsm_detail_xxhash(digest)(&state);
 	}
 
+	// One-shot hash of a contiguous buffer. Equivalent to appending the buffer to a new state.
+	static size_t hash_bytes(size_t const seed, void const* const data, size_t const size)
+	{
+		return vsm_pp_cat(XXH, vsm_word_bits)(data, size, seed);
+	}
+
+	// One-shot hash of a single integer of the given size in bytes, held in the low bytes of the
+	// word. Equivalent to appending the object representation of the integer to a new state. The
+	// 64-bit hash specializes the XXH64 short input path for the size of the integer, reading the
+	// bytes from the word rather than from memory.
+	vsm_always_inline static size_t hash_word(
+		size_t const seed,
+		uint64_t word,
+		size_t const size)
+	{
+		if constexpr (vsm_word_64)
+		{
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				// XXH64 reads its input as little endian.
+				word = vsm::byteswap(word) >> (sizeof(word) - size) * CHAR_BIT;
+			}
+
+			return static_cast<size_t>(_hash_word_64(static_cast<uint64_t>(seed), word, size));
+		}
+		else
+		{
+			auto const* data = reinterpret_cast<unsigned char const*>(&word);
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				data += sizeof(word) - size;
+			}
+			return hash_bytes(seed, data, size);
+		}
+	}
+
+	// Computes hash_word for each of the words. Eight or four words of 64 or 32 bits are hashed in
+	// parallel using AVX-512 or AVX2 respectively, where available.
+	template<typename T>
+	static void hash_words(
+		size_t const seed,
+		T const* const words,
+		size_t* const hashes,
+		size_t const count)
+	{
+		size_t i = 0;
+
+#if vsm_arch_x86_avx512dq || vsm_arch_x86_avx2
+		if constexpr (
+			vsm_word_64 &&
+			(sizeof(T) == sizeof(uint64_t) || sizeof(T) == sizeof(uint32_t)))
+		{
+			i = _hash_words_x86(static_cast<uint64_t>(seed), words, hashes, count);
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			hashes[i] = hash_word(seed, static_cast<uint64_t>(words[i]), sizeof(T));
+		}
+	}
+
 private:
+	static constexpr uint64_t _prime_1 = 0x9E3779B185EBCA87;
+	static constexpr uint64_t _prime_2 = 0xC2B2AE3D27D4EB4F;
+	static constexpr uint64_t _prime_3 = 0x165667B19E3779F9;
+	static constexpr uint64_t _prime_4 = 0x85EBCA77C2B2AE63;
+	static constexpr uint64_t _prime_5 = 0x27D4EB2F165667C5;
+
+	// XXH64 of the first size bytes of the little endian word.
+	vsm_always_inline static uint64_t _hash_word_64(
+		uint64_t const seed,
+		uint64_t word,
+		size_t const size)
+	{
+		uint64_t h = seed + _prime_5 + size;
+
+		if (size == sizeof(uint64_t))
+		{
+			h ^= std::rotl(word * _prime_2, 31) * _prime_1;
+			h = std::rotl(h, 27) * _prime_1 + _prime_4;
+		}
+		else
+		{
+			size_t remaining = size;
+
+			if (remaining >= sizeof(uint32_t))
+			{
+				h ^= (word & 0xFFFFFFFF) * _prime_1;
+				h = std::rotl(h, 23) * _prime_2 + _prime_3;
+				word >>= 32;
+				remaining -= sizeof(uint32_t);
+			}
+
+			for (; remaining != 0; --remaining)
+			{
+				h ^= (word & 0xFF) * _prime_5;
+				h = std::rotl(h, 11) * _prime_1;
+				word >>= 8;
+			}
+		}
+
+		h ^= h >> 33;
+		h *= _prime_2;
+		h ^= h >> 29;
+		h *= _prime_3;
+		h ^= h >> 32;
+		return h;
+	}
+
+#if vsm_arch_x86_avx512dq || vsm_arch_x86_avx2
+	// Returns the number of words hashed.
+	template<typename T>
+	static size_t _hash_words_x86(
+		uint64_t const seed,
+		T const* const words,
+		size_t* const hashes,
+		size_t const count)
+	{
+		size_t i = 0;
+
+#	if vsm_arch_x86_avx512dq
+		__m512i const v_seed = _mm512_set1_epi64(
+			static_cast<int64_t>(seed + _prime_5 + sizeof(T)));
+		__m512i const v_prime_1 = _mm512_set1_epi64(static_cast<int64_t>(_prime_1));
+		__m512i const v_prime_2 = _mm512_set1_epi64(static_cast<int64_t>(_prime_2));
+		__m512i const v_prime_3 = _mm512_set1_epi64(static_cast<int64_t>(_prime_3));
+
+		for (; count - i >= 8; i += 8)
+		{
+			__m512i h;
+			if constexpr (sizeof(T) == sizeof(uint64_t))
+			{
+				__m512i v = _mm512_loadu_si512(words + i);
+				v = _mm512_rol_epi64(_mm512_mullo_epi64(v, v_prime_2), 31);
+				v = _mm512_mullo_epi64(v, v_prime_1);
+				h = _mm512_xor_si512(v_seed, v);
+				h = _mm512_add_epi64(
+					_mm512_mullo_epi64(_mm512_rol_epi64(h, 27), v_prime_1),
+					_mm512_set1_epi64(static_cast<int64_t>(_prime_4)));
+			}
+			else
+			{
+				// Only the object representation of the 32-bit words is hashed.
+				__m512i const v = _mm512_cvtepu32_epi64(
+					_mm256_loadu_si256(reinterpret_cast<__m256i const*>(words + i)));
+				h = _mm512_xor_si512(v_seed, _mm512_mullo_epi64(v, v_prime_1));
+				h = _mm512_add_epi64(
+					_mm512_mullo_epi64(_mm512_rol_epi64(h, 23), v_prime_2),
+					v_prime_3);
+			}
+
+			h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 33));
+			h = _mm512_mullo_epi64(h, v_prime_2);
+			h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 29));
+			h = _mm512_mullo_epi64(h, v_prime_3);
+			h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 32));
+
+			_mm512_storeu_si512(hashes + i, h);
+		}
+#	else
+		__m256i const v_seed = _mm256_set1_epi64x(
+			static_cast<int64_t>(seed + _prime_5 + sizeof(T)));
+
+		for (; count - i >= 4; i += 4)
+		{
+			__m256i h;
+			if constexpr (sizeof(T) == sizeof(uint64_t))
+			{
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(words + i));
+				v = _mul_avx2<_prime_1>(_rotl_avx2<31>(_mul_avx2<_prime_2>(v)));
+				h = _mm256_xor_si256(v_seed, v);
+				h = _mm256_add_epi64(
+					_mul_avx2<_prime_1>(_rotl_avx2<27>(h)),
+					_mm256_set1_epi64x(static_cast<int64_t>(_prime_4)));
+			}
+			else
+			{
+				// Only the object representation of the 32-bit words is hashed.
+				__m256i const v = _mm256_cvtepu32_epi64(
+					_mm_loadu_si128(reinterpret_cast<__m128i const*>(words + i)));
+				h = _mm256_xor_si256(v_seed, _mul_avx2<_prime_1>(v));
+				h = _mm256_add_epi64(
+					_mul_avx2<_prime_2>(_rotl_avx2<23>(h)),
+					_mm256_set1_epi64x(static_cast<int64_t>(_prime_3)));
+			}
+
+			h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+			h = _mul_avx2<_prime_2>(h);
+			h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 29));
+			h = _mul_avx2<_prime_3>(h);
+			h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 32));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes + i), h);
+		}
+#	endif
+
+		return i;
+	}
+#endif
+
+#if vsm_arch_x86_avx2 && !vsm_arch_x86_avx512dq
+	// AVX2 has no 64-bit multiplication, so it is composed of 32-bit multiplications.
+	template<uint64_t Prime>
+	static vsm_always_inline __m256i _mul_avx2(__m256i const v)
+	{
+		__m256i const p_lo = _mm256_set1_epi64x(static_cast<int64_t>(Prime & 0xFFFFFFFF));
+		__m256i const p_hi = _mm256_set1_epi64x(static_cast<int64_t>(Prime >> 32));
+
+		__m256i const cross = _mm256_add_epi64(
+			_mm256_mul_epu32(_mm256_srli_epi64(v, 32), p_lo),
+			_mm256_mul_epu32(v, p_hi));
+
+		return _mm256_add_epi64(_mm256_mul_epu32(v, p_lo), _mm256_slli_epi64(cross, 32));
+	}
+
+	template<int Shift>
+	static vsm_always_inline __m256i _rotl_avx2(__m256i const v)
+	{
+		return _mm256_or_si256(_mm256_slli_epi64(v, Shift), _mm256_srli_epi64(v, 64 - Shift));
+	}
+#endif
+
 	vsm_always_inline friend void tag_invoke(
 		decltype(hash_append_bits),
 		state_type& state,
@@ -0,0 +1,93 @@
+#include <vsm/buffered_hash.hpp>
+#include <vsm/xxh3.hpp>
+#include <vsm/xxhash.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+struct record
+{
+	uint32_t id;
+	uint16_t kind;
+	std::string_view name;
+	std::vector<uint64_t> values;
+
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, record const& r)
+	{
+		hash_append(state, r.id);
+		hash_append(state, r.kind);
+		hash_append(state, r.name);
+		for (uint64_t const value : r.values)
+		{
+			hash_append(state, value);
+		}
+	}
+};
+
+// Provides no one-shot hash_bytes, so the buffered state must initialize the underlying state
+// itself when finalizing.
+struct streaming_only_hash
+{
+	using state_type = xxhash::state_type;
+
+	static state_type initialize(size_t const seed)
+	{
+		return xxhash::initialize(seed);
+	}
+
+	static size_t finalize(state_type const& state)
+	{
+		return xxhash::finalize(state);
+	}
+};
+
+TEMPLATE_TEST_CASE(
+	"buffered_hash produces the values of the underlying hash",
+	"[hash]",
+	xxhash,
+	xxh3)
+{
+	std::string const string(300, 'x');
+
+	for (size_t name_size = 0; name_size <= string.size(); name_size += 13)
+	{
+		for (size_t value_count = 0; value_count < 20; value_count += 3)
+		{
+			record r = { 42, 7, std::string_view(string.data(), name_size), {} };
+			for (size_t i = 0; i < value_count; ++i)
+			{
+				r.values.push_back(i * 0x9E3779B97F4A7C15);
+			}
+
+			size_t const expected = basic_hasher<TestType>()(r);
+			REQUIRE(basic_hasher<buffered_hash<TestType>>()(r) == expected);
+			REQUIRE(basic_hasher<buffered_hash<TestType, 8>>()(r) == expected);
+			REQUIRE(basic_hasher<buffered_hash<TestType, 256>>()(r) == expected);
+
+			auto const tuple = std::make_tuple(r.id, r.kind, r.name);
+			size_t const expected_tuple = basic_hasher<TestType>()(tuple);
+			REQUIRE(basic_hasher<buffered_hash<TestType>>()(tuple) == expected_tuple);
+		}
+	}
+}
+
+TEST_CASE("buffered_hash without one-shot hashing", "[hash]")
+{
+	record const small = { 1, 2, "hello", {} };
+	record const large = { 1, 2, "hello", std::vector<uint64_t>(100, 3) };
+
+	using hasher = basic_hasher<buffered_hash<streaming_only_hash>>;
+	REQUIRE(hasher()(small) == basic_hasher<xxhash>()(small));
+	REQUIRE(hasher()(large) == basic_hasher<xxhash>()(large));
+}
+
+} // namespace
@@ -0,0 +1,82 @@
+#include <vsm/constexpr_hash.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+using namespace vsm;
+
+namespace {
+
+enum class record_kind : uint8_t
+{
+	red,
+	green,
+};
+
+struct record
+{
+	uint32_t id;
+	record_kind kind;
+	std::string_view name;
+
+	template<typename State>
+	friend constexpr void tag_invoke(decltype(hash_append), State& state, record const& r)
+	{
+		hash_append(state, r.id);
+		hash_append(state, r.kind);
+		hash_append(state, r.name);
+	}
+};
+
+constexpr std::string_view text = "the quick brown fox jumps over the lazy dog";
+
+// Hashes of all prefixes of the text, computed in a constant expression.
+constexpr auto prefix_hashes = []()
+{
+	std::array<size_t, text.size() + 1> hashes = {};
+	for (size_t i = 0; i <= text.size(); ++i)
+	{
+		hashes[i] = constexpr_hasher()(text.substr(0, i));
+	}
+	return hashes;
+}();
+
+constexpr size_t record_hash = constexpr_hasher()(record{ 42, record_kind::green, "hello" });
+
+static_assert(constexpr_hasher()(uint32_t(1)) != constexpr_hasher()(uint32_t(2)));
+static_assert(constexpr_hasher()(uint32_t(1)) != constexpr_hasher()(uint64_t(1)));
+static_assert(constexpr_hasher()(record_kind::red) == constexpr_hasher()(uint8_t(0)));
+static_assert(
+	constexpr_hasher()(std::string_view("ab")) !=
+	constexpr_hasher()(std::string_view("ab\0", 3)));
+
+} // namespace
+
+TEST_CASE("constexpr_hash produces equal values at compile time and at run time", "[hash]")
+{
+	// The object representation of the characters is appended at once at run time.
+	std::string const string(text);
+	for (size_t i = 0; i <= string.size(); ++i)
+	{
+		REQUIRE(constexpr_hasher()(std::string_view(string).substr(0, i)) == prefix_hashes[i]);
+	}
+
+	std::string const name = "hello";
+	record const r = { 42, record_kind::green, name };
+	CHECK(constexpr_hasher()(r) == record_hash);
+	CHECK(constexpr_hasher()(std::make_tuple(r.id, r.kind, r.name)) == record_hash);
+}
+
+TEST_CASE("constexpr_hash appends integers as their object representation", "[hash]")
+{
+	uint64_t const value = 0x0123'4567'89AB'CDEF;
+
+	constexpr_hash::state_type state = constexpr_hash::initialize(0);
+	hash_append_bits(state, static_cast<void const*>(&value), sizeof(value));
+
+	CHECK(constexpr_hasher()(value) == constexpr_hash::finalize(state));
+}
@@ -2,6 +2,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <string>
+#include <string_view>
+
 using namespace vsm;
 
 namespace {
@@ -41,4 +44,41 @@ TEST_CASE("default_hash with custom policy", "[hash]")
 	REQUIRE(h1 == h2);
 }
 
+// Hashes strings case insensitively.
+struct case_insensitive_policy
+{
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, std::string const& string)
+	{
+		for (char const c : string)
+		{
+			hash_append(state, static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c));
+		}
+	}
+};
+
+TEST_CASE("default_hash with custom policy for contiguous range", "[hash]")
+{
+	using hasher = basic_default_hasher<case_insensitive_policy>;
+
+	REQUIRE(hasher()(std::string("Hello")) == hasher()(std::string("hello")));
+	REQUIRE(hasher()(std::string("Hello")) == hasher()(std::string_view("hello")));
+	REQUIRE(hasher()(std::string("Hello")) != hasher()(std::string_view("Hello")));
+}
+
+struct my_stable_hash_policy : stable_hash_policy {};
+
+TEST_CASE("default_hash with stable policy", "[hash]")
+{
+	std::string_view const string = "hello";
+
+	vsm_detail_xxhash(state_t) state;
+	vsm_detail_xxhash(reset)(&state, 0);
+	vsm_detail_xxhash(update)(&state, string.data(), string.size());
+	size_t const expected = vsm_detail_xxhash(digest)(&state);
+
+	REQUIRE(stable_hasher()(string) == expected);
+	REQUIRE(basic_default_hasher<my_stable_hash_policy>()(string) == expected);
+}
+
 } // namespace
@@ -0,0 +1,100 @@
+#include <vsm/xxh3.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+struct pair
+{
+	int i;
+	std::string_view s;
+
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, pair const& p)
+	{
+		hash_append(state, p.i);
+		hash_append(state, p.s);
+	}
+};
+
+// A range type with its own hash_append customization, which must not be hashed as raw bytes.
+struct case_insensitive_string : std::string
+{
+	using std::string::string;
+
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, case_insensitive_string const& s)
+	{
+		for (char const c : s)
+		{
+			hash_append(state, static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c));
+		}
+	}
+};
+
+static size_t hash_manually(size_t const seed, void const* const data, size_t const size)
+{
+	XXH3_state_t state;
+	XXH3_INITSTATE(&state);
+	XXH3_64bits_reset_withSeed(&state, seed);
+	XXH3_64bits_update(&state, data, size);
+	return static_cast<size_t>(XXH3_64bits_digest(&state));
+}
+
+static size_t hash_manually(pair const& p)
+{
+	XXH3_state_t state;
+	XXH3_INITSTATE(&state);
+	XXH3_64bits_reset_withSeed(&state, get_aslr_seed());
+	XXH3_64bits_update(&state, &p.i, sizeof(p.i));
+	XXH3_64bits_update(&state, p.s.data(), p.s.size());
+	return static_cast<size_t>(XXH3_64bits_digest(&state));
+}
+
+TEST_CASE("xxh3", "[hash]")
+{
+	pair const p = { 42, "hello" };
+	REQUIRE(basic_hasher<xxh3>()(p) == hash_manually(p));
+}
+
+TEST_CASE("xxh3 one-shot hashing matches streaming", "[hash]")
+{
+	size_t const seed = get_aslr_seed();
+
+	std::string const string(1000, 'x');
+	for (size_t size = 0; size <= string.size(); size += 37)
+	{
+		std::string_view const s(string.data(), size);
+		REQUIRE(basic_hasher<xxh3>()(s) == hash_manually(seed, s.data(), s.size()));
+	}
+
+	std::vector<uint32_t> const vector = { 1, 2, 3, 4, 5 };
+	REQUIRE(basic_hasher<xxh3>()(vector) == hash_manually(
+		seed,
+		vector.data(),
+		vector.size() * sizeof(uint32_t)));
+
+	uint64_t const u64 = 0x0123456789abcdef;
+	REQUIRE(basic_hasher<xxh3>()(u64) == hash_manually(seed, &u64, sizeof(u64)));
+
+	int16_t const i16 = -2;
+	REQUIRE(basic_hasher<xxh3>()(i16) == hash_manually(seed, &i16, sizeof(i16)));
+
+	REQUIRE(basic_hasher<xxh3, stable_hash_policy>()(u64) == XXH3_64bits(&u64, sizeof(u64)));
+}
+
+TEST_CASE("xxh3 one-shot hashing respects customizations", "[hash]")
+{
+	case_insensitive_string const s = "Hello";
+	REQUIRE(basic_hasher<xxh3>()(s) == basic_hasher<xxh3>()(case_insensitive_string("hELLO")));
+	REQUIRE(basic_hasher<xxh3>()(s) == basic_hasher<xxh3>()(std::string_view("hello")));
+	REQUIRE(basic_hasher<xxh3>()(s) != basic_hasher<xxh3>()(std::string_view("Hello")));
+}
+
+} // namespace
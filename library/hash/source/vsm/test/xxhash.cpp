@@ -1,7 +1,13 @@
+#include <vsm/default_hash.hpp>
 #include <vsm/xxhash.hpp>
 
 #include <catch2/catch_all.hpp>
 
+#include <array>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 using namespace vsm;
 
 namespace {
@@ -38,4 +44,163 @@ TEST_CASE("xxhash", "[hash]")
 	REQUIRE(h1 == h2);
 }
 
+struct seed_policy
+{
+	static constexpr size_t seed = 0x12345678;
+};
+
+template<typename T>
+struct wrapper
+{
+	T value;
+
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, wrapper const& w)
+	{
+		hash_append(state, w.value);
+	}
+};
+
+static size_t hash_manually(size_t const seed, void const* const data, size_t const size)
+{
+	vsm_detail_xxhash(state_t) state;
+	vsm_detail_xxhash(reset)(&state, seed);
+	vsm_detail_xxhash(update)(&state, data, size);
+	return vsm_detail_xxhash(digest)(&state);
+}
+
+TEMPLATE_TEST_CASE(
+	"xxhash single word matches streaming",
+	"[hash]",
+	uint64_t,
+	int64_t,
+	uint32_t,
+	int32_t,
+	uint16_t,
+	int16_t,
+	uint8_t,
+	bool)
+{
+	for (uint64_t i = 0; i < 64; ++i)
+	{
+		auto const value = static_cast<TestType>(i * 0x9E3779B97F4A7C15);
+
+		size_t const h = basic_hasher<xxhash>()(value);
+		REQUIRE(h == hash_manually(get_aslr_seed(), &value, sizeof(value)));
+		REQUIRE(h == basic_hasher<xxhash>()(wrapper<TestType>{ value }));
+		REQUIRE(h == basic_hasher<xxhash>()(std::array<TestType, 1>{ value }));
+		REQUIRE(h == default_hasher()(value));
+		REQUIRE(h == default_hasher()(wrapper<TestType>{ value }));
+
+		size_t const stable_h = basic_hasher<xxhash, stable_hash_policy>()(value);
+		REQUIRE(stable_h == hash_manually(0, &value, sizeof(value)));
+		REQUIRE(stable_h == stable_hasher()(wrapper<TestType>{ value }));
+		REQUIRE(basic_hasher<xxhash, seed_policy>()(value) == hash_manually(
+			seed_policy::seed,
+			&value,
+			sizeof(value)));
+	}
+}
+
+TEST_CASE("xxhash single word", "[hash]")
+{
+	uint64_t const value = 42;
+	int const i = 42;
+
+	size_t const h = basic_hasher<xxhash>()(value);
+	REQUIRE(h == xxhash::hash_word(get_aslr_seed(), value, sizeof(value)));
+	REQUIRE(h != basic_hasher<xxhash>()(i));
+	REQUIRE(h != basic_hasher<xxhash, stable_hash_policy>()(value));
+	REQUIRE(h != basic_hasher<xxhash, seed_policy>()(value));
+
+	int const* const ptr = &i;
+	REQUIRE(basic_hasher<xxhash>()(ptr) == basic_hasher<xxhash>()(wrapper<int const*>{ ptr }));
+
+	std::unordered_set<size_t> low_bits;
+	for (uint64_t k = 0; k < 4096; ++k)
+	{
+		low_bits.insert(basic_hasher<xxhash>()(k << 32) & 0xfff);
+	}
+	REQUIRE(low_bits.size() > 2048);
+}
+
+// Hashes int as its negation, so that the one-shot path must not be used for int.
+struct negating_policy
+{
+	template<typename State>
+	friend void tag_invoke(decltype(hash_append), State& state, int const value)
+	{
+		hash_append(state, static_cast<unsigned>(-value));
+	}
+};
+
+TEST_CASE("xxhash single word respects policy customizations", "[hash]")
+{
+	using hasher = basic_default_hasher<negating_policy>;
+	REQUIRE(hasher()(5) == hasher()(static_cast<unsigned>(-5)));
+	REQUIRE(hasher()(5) != hasher()(5u));
+}
+
+template<typename Hasher, typename T>
+static void check_hash_many(std::vector<T> const& values)
+{
+	for (size_t size = 0; size <= values.size(); ++size)
+	{
+		std::vector<size_t> hashes(size);
+		Hasher::hash_many(std::span(values.data(), size), std::span(hashes));
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			REQUIRE(hashes[i] == Hasher()(values[i]));
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE(
+	"xxhash hash_many",
+	"[hash]",
+	uint64_t,
+	int64_t,
+	uint32_t,
+	int32_t,
+	uint16_t,
+	int8_t)
+{
+	std::vector<TestType> values;
+	for (uint64_t i = 0; i < 19; ++i)
+	{
+		values.push_back(static_cast<TestType>(i * 0x9E3779B97F4A7C15));
+	}
+
+	check_hash_many<basic_hasher<xxhash>>(values);
+	check_hash_many<basic_hasher<xxhash, stable_hash_policy>>(values);
+	check_hash_many<basic_default_hasher<seed_policy>>(values);
+}
+
+TEST_CASE("xxhash hash_many respects policy customizations", "[hash]")
+{
+	std::vector<int> values;
+	for (int i = -10; i < 30; ++i)
+	{
+		values.push_back(static_cast<int>(static_cast<unsigned>(i) * 0x2F1B3C4Du));
+	}
+
+	check_hash_many<basic_default_hasher<negating_policy>>(values);
+	check_hash_many<basic_hasher<xxhash, negating_policy>>(values);
+}
+
+TEST_CASE("xxhash hash_many non-word values", "[hash]")
+{
+	int objects[7];
+	std::vector<int const*> pointers;
+	for (int const& object : objects)
+	{
+		pointers.push_back(&object);
+	}
+	check_hash_many<basic_hasher<xxhash>>(pointers);
+
+	std::vector<std::string> const strings = { "a", "bc", "def", "" };
+	check_hash_many<default_hasher>(strings);
+}
+
 } // namespace
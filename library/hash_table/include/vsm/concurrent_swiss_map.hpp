@@ -0,0 +1,217 @@
+#pragma once
+
+#include <vsm/swiss_map.hpp>
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+namespace vsm {
+namespace detail {
+
+// Shards are aligned to avoid false sharing between the locks of neighbouring shards.
+inline constexpr size_t _concurrent_swiss_map_shard_alignment = 64;
+
+} // namespace detail
+
+// A swiss_map safe for concurrent use by multiple threads. Keys are distributed across ShardCount
+// independently locked swiss_map shards. Lookups take a shared lock on a single shard, such that
+// concurrent lookups do not contend with each other except on the cache line of the lock itself.
+// Modifications take an exclusive lock on a single shard.
+template<
+	typename Key,
+	typename Value,
+	size_t ShardCount = 64,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+class concurrent_swiss_map
+{
+	static_assert(std::has_single_bit(ShardCount));
+
+	using map_type = swiss_map<Key, Value, KeySelector, Allocator, Hasher, Comparator>;
+
+	struct alignas(detail::_concurrent_swiss_map_shard_alignment) shard
+	{
+		std::shared_mutex mutable mutex;
+		map_type map;
+	};
+
+	std::array<shard, ShardCount> m_shards;
+
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = typename map_type::value_type;
+
+
+	concurrent_swiss_map() = default;
+
+	concurrent_swiss_map(concurrent_swiss_map const&) = delete;
+	concurrent_swiss_map& operator=(concurrent_swiss_map const&) = delete;
+
+
+	[[nodiscard]] static constexpr size_t shard_count() noexcept
+	{
+		return ShardCount;
+	}
+
+	// The returned size may be outdated by the time it is observed by the caller.
+	[[nodiscard]] size_t size() const
+	{
+		size_t size = 0;
+		for (shard const& s : m_shards)
+		{
+			std::shared_lock const lock(s.mutex);
+			size += s.map.size();
+		}
+		return size;
+	}
+
+	// The capacity is distributed evenly among the shards.
+	void reserve(size_t const min_capacity)
+	{
+		size_t const shard_capacity = (min_capacity + ShardCount - 1) / ShardCount;
+
+		for (shard& s : m_shards)
+		{
+			std::unique_lock const lock(s.mutex);
+			s.map.reserve(shard_capacity);
+		}
+	}
+
+	void clear()
+	{
+		for (shard& s : m_shards)
+		{
+			std::unique_lock const lock(s.mutex);
+			s.map.clear();
+		}
+	}
+
+
+	// Returns a copy of the value associated with the key, if any.
+	template<detail::hash_table_key<map_type> K>
+	[[nodiscard]] std::optional<Value> find(K const& key) const
+	{
+		std::optional<Value> result;
+		visit(key, [&](value_type const& element)
+		{
+			result.emplace(element.value);
+		});
+		return result;
+	}
+
+	template<detail::hash_table_key<map_type> K>
+	[[nodiscard]] bool contains(K const& key) const
+	{
+		return visit(key, [](value_type const&) {});
+	}
+
+	// Invokes the visitor with the element associated with the key, if any, while holding a shared
+	// lock on the shard containing the key. Returns true if the element was found.
+	template<detail::hash_table_key<map_type> K, typename Visitor>
+	bool visit(K const& key, Visitor&& visitor) const
+	{
+		// All shards have equal policies which are never modified, so any shard may be used for
+		// hashing without holding its lock.
+		size_t const hash = m_shards[0].map.hash(key);
+		shard const& s = get_shard(hash);
+
+		std::shared_lock const lock(s.mutex);
+
+		auto const it = s.map.find_with_hash(hash, key);
+		if (it == s.map.end())
+		{
+			return false;
+		}
+
+		vsm_forward(visitor)(*it);
+		return true;
+	}
+
+	// Invokes the visitor with each element in the map. The visitor is invoked while holding a
+	// shared lock on the shard containing the element.
+	template<typename Visitor>
+	void visit_all(Visitor&& visitor) const
+	{
+		for (shard const& s : m_shards)
+		{
+			std::shared_lock const lock(s.mutex);
+
+			for (value_type const& element : s.map)
+			{
+				visitor(element);
+			}
+		}
+	}
+
+
+	// Returns true if the element was inserted.
+	template<detail::hash_table_key<map_type> K, std::convertible_to<Value> V>
+	bool insert(K&& key, V&& value)
+	{
+		size_t const hash = m_shards[0].map.hash(key);
+		shard& s = get_shard(hash);
+
+		std::unique_lock const lock(s.mutex);
+		return s.map.insert_with_hash(hash, vsm_forward(key), vsm_forward(value)).inserted;
+	}
+
+	// Returns true if the element was inserted, or false if an existing element was assigned.
+	template<detail::hash_table_key<map_type> K, std::convertible_to<Value> V>
+	bool insert_or_assign(K&& key, V&& value)
+	{
+		size_t const hash = m_shards[0].map.hash(key);
+		shard& s = get_shard(hash);
+
+		std::unique_lock const lock(s.mutex);
+		return s.map.insert_or_assign_with_hash(
+			hash,
+			vsm_forward(key),
+			vsm_forward(value)).inserted;
+	}
+
+	template<detail::hash_table_key<map_type> K>
+	size_t erase(K const& key)
+	{
+		size_t const hash = m_shards[0].map.hash(key);
+		shard& s = get_shard(hash);
+
+		std::unique_lock const lock(s.mutex);
+		return s.map.erase_with_hash(hash, key);
+	}
+
+private:
+	// The swiss table uses the low bits of the hash to select the control group and the control
+	// byte. The highest bits are used for shard selection, so that they are independent.
+	[[nodiscard]] static size_t get_shard_index(size_t const hash) noexcept
+	{
+		static constexpr int shard_bits = std::countr_zero(ShardCount);
+
+		if constexpr (shard_bits == 0)
+		{
+			return 0;
+		}
+		else
+		{
+			return hash >> (sizeof(size_t) * CHAR_BIT - shard_bits);
+		}
+	}
+
+	[[nodiscard]] shard& get_shard(size_t const hash) noexcept
+	{
+		return m_shards[get_shard_index(hash)];
+	}
+
+	[[nodiscard]] shard const& get_shard(size_t const hash) const noexcept
+	{
+		return m_shards[get_shard_index(hash)];
+	}
+};
+
+} // namespace vsm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vsm/default_hash.hpp>
+#include <vsm/detail/array_table.hpp>
+#include <vsm/hash_map.hpp>
+#include <vsm/key_selector.hpp>
+
+namespace vsm {
+
+// Like array_map, but erasure moves the last element into the place of the erased element in
+// constant time, instead of preserving the insertion order of the remaining elements.
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using dense_map_base = new_basic_hash_map_base<
+	detail::_array_table_base_impl<
+		key_value_pair<Key, Value>,
+		Key,
+		uint_least32_t,
+		hash_table_policies<KeySelector, Hasher, Comparator>,
+		Allocator,
+		/* Ordered: */ false>>;
+
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using dense_map = detail::_array_table_impl<
+	dense_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator>,
+	/* Capacity: */ 0>;
+
+template<
+	typename Key,
+	typename Value,
+	size_t Capacity,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using small_dense_map = detail::_array_table_impl<
+	dense_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator>,
+	Capacity>;
+
+} // namespace vsm
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vsm/default_hash.hpp>
+#include <vsm/detail/array_table.hpp>
+#include <vsm/hash_set.hpp>
+#include <vsm/key_selector.hpp>
+
+namespace vsm {
+
+// Like array_set, but erasure moves the last element into the place of the erased element in
+// constant time, instead of preserving the insertion order of the remaining elements.
+template<
+	typename T,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using dense_set_base = new_basic_hash_set_base<
+	detail::_array_table_base_impl<
+		T,
+		T,
+		uint_least32_t,
+		hash_table_policies<KeySelector, Hasher, Comparator>,
+		Allocator,
+		/* Ordered: */ false>>;
+
+template<
+	typename T,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using dense_set = detail::_array_table_impl<
+	dense_set_base<T, KeySelector, Allocator, Hasher, Comparator>,
+	/* Capacity: */ 0>;
+
+template<
+	typename T,
+	size_t Capacity,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+using small_dense_set = detail::_array_table_impl<
+	dense_set_base<T, KeySelector, Allocator, Hasher, Comparator>,
+	Capacity>;
+
+} // namespace vsm
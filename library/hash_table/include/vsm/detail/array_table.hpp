@@ -14,6 +14,7 @@
 
 #include <bit>
 #include <limits>
+#include <ranges>
 
 namespace vsm::detail {
 
@@ -34,12 +35,15 @@ inline vsm_always_inline _array_table_hash_t<I> _array_table_hash(size_t const h
 }
 
 
+// If Ordered is true, erasure preserves the insertion order of the remaining elements in linear
+// time. Otherwise the last element is moved into the place of the erased element in constant time.
 template<
 	typename T,
 	typename K,
 	typename I,
 	typename P,
-	typename A>
+	typename A,
+	bool Ordered = true>
 class _array_table_base_impl;
 
 template<typename ArrayTableBase, size_t Capacity>
@@ -378,6 +382,13 @@ void _array_table_shift_indices(
 	for (_array_table_bucket<I>& bucket : std::span(buckets, hash_mask + 1))
 	{
 		size_t const old_index = bucket.load_index();
+
+		// Empty buckets must be preserved.
+		if (old_index == std::numeric_limits<I>::max())
+		{
+			continue;
+		}
+
 		size_t const new_index = old_index < min_index
 			? old_index
 			: old_index + static_cast<size_t>(index_shift);
@@ -708,6 +719,34 @@ insert_result<void*> _array_table_insert(
 	return { data + table.m_size++ * SizeofT, true };
 }
 
+template<size_t SizeofT, typename I>
+void* _array_table_insert_unique(
+	_array_table<I>& table,
+	size_t const hash,
+	_array_table_resize_t<I>* const resize)
+{
+	if (table.m_size == _array_table_max_size(table.m_hash_mask))
+	{
+		resize(table);
+	}
+
+	size_t const hash_mask = table.m_hash_mask;
+
+	_array_table_bucket<I>* const buckets = table._get_ptr();
+	unsigned char* const data = _array_table_data(buckets, hash_mask);
+
+	_array_table_insert_1(
+		buckets,
+		hash_mask,
+		_array_table_bucket<I>(table.m_size, _array_table_hash<I>(hash)));
+
+#if vsm_has_address_sanitizer
+	_array_table_update_annotation<SizeofT>(table, table.m_size, table.m_size + 1);
+#endif
+
+	return data + table.m_size++ * SizeofT;
+}
+
 template<typename T, typename I>
 void _array_table_erase(_array_table<I>& table, size_t const bucket_index)
 {
@@ -731,6 +770,60 @@ void _array_table_erase(_array_table<I>& table, size_t const bucket_index)
 		_array_table_shift_indices(buckets, hash_mask, data_index + 1, -1);
 	}
 
+#if vsm_has_address_sanitizer
+	_array_table_update_annotation<sizeof(T)>(table, table_size, table_size - 1);
+#endif
+
+	bucket.store_index(std::numeric_limits<I>::max());
+	_array_table_shift_buckets(buckets, hash_mask, bucket_index);
+}
+
+template<typename T, typename K, typename I, typename P>
+void _array_table_erase_unordered(_array_table_with_policies<I, P>& table, size_t const bucket_index)
+{
+	size_t const hash_mask = table.m_hash_mask;
+
+	_array_table_bucket<I>* const buckets = table._get_ptr();
+	unsigned char* const data = _array_table_data(buckets, hash_mask);
+
+	_array_table_bucket<I>& bucket = buckets[bucket_index];
+
+	size_t const data_index = bucket.load_index();
+	size_t const last_index = table.m_size - 1;
+
+	T* const slot = reinterpret_cast<T*>(data) + data_index;
+	T* const last_slot = reinterpret_cast<T*>(data) + last_index;
+
+	// The hasher may throw, so the last element is hashed before the table is modified.
+	size_t last_hash = 0;
+	if (data_index != last_index)
+	{
+		last_hash = static_cast<P const&>(table.m_policies)
+			.hasher(vsm::normalize_key(
+				static_cast<P const&>(table.m_policies)
+					.key_selector(*reinterpret_cast<K const*>(last_slot))));
+	}
+
+	std::destroy_at(slot);
+	table.m_size = static_cast<I>(last_index);
+
+	if (data_index != last_index)
+	{
+		// Find the bucket referring to the last element by its hash.
+		size_t last_bucket_index = last_hash & hash_mask;
+		while (buckets[last_bucket_index].load_index() != last_index)
+		{
+			last_bucket_index = (last_bucket_index + 1) & hash_mask;
+		}
+
+		vsm::relocate_at(last_slot, slot);
+		buckets[last_bucket_index].store_index(static_cast<I>(data_index));
+	}
+
+#if vsm_has_address_sanitizer
+	_array_table_update_annotation<sizeof(T)>(table, last_index + 1, last_index);
+#endif
+
 	bucket.store_index(std::numeric_limits<I>::max());
 	_array_table_shift_buckets(buckets, hash_mask, bucket_index);
 }
@@ -891,13 +984,150 @@ void _array_table_move_assign(
 	_array_table_move<T>(dst, src);
 }
 
+// Copies the elements of src into the empty table dst. The buckets are copied verbatim without
+// rehashing. The existing storage of dst is reused if its capacity is equal.
+// If copying an element throws, dst is left empty.
+template<typename T, typename I, typename P, typename A>
+void _array_table_copy(
+	_array_table_with_allocator<I, P, A>& dst,
+	_array_table_with_allocator<I, P, A> const& src)
+{
+	vsm_assert(dst.m_size == 0);
+
+	size_t const size = src.m_size;
+
+	if (size == 0)
+	{
+		return;
+	}
+
+	size_t const hash_mask = src.m_hash_mask;
+	size_t const buckets_size = (hash_mask + 1) * sizeof(_array_table_bucket<I>);
+
+	_array_table_bucket<I>* const src_buckets = src._get_ptr();
+	T const* const src_data = reinterpret_cast<T const*>(_array_table_data(src_buckets, hash_mask));
+
+	if (dst.m_hash_mask == hash_mask)
+	{
+		_array_table_bucket<I>* const dst_buckets = dst._get_ptr();
+		T* const dst_data = reinterpret_cast<T*>(_array_table_data(dst_buckets, hash_mask));
+
+#if vsm_has_address_sanitizer
+		_array_table_update_annotation<sizeof(T)>(dst, 0, size);
+#endif
+
+		vsm_except_try
+		{
+			std::uninitialized_copy_n(src_data, size, dst_data);
+		}
+		vsm_except_catch(...)
+		{
+#if vsm_has_address_sanitizer
+			_array_table_update_annotation<sizeof(T)>(dst, size, 0);
+#endif
+			vsm_except_rethrow;
+		}
+
+		vsm_memcpy_no_sanitize_address(dst_buckets, src_buckets, buckets_size);
+	}
+	else
+	{
+		size_t const storage_size = _array_table_storage_size<I>(hash_mask, sizeof(T));
+
+		// The storage is allocated with the exact capacity of src, so that the buckets can be
+		// copied verbatim.
+		auto const new_allocation = vsm::allocate_or_throw(dst.m_allocator, storage_size);
+		auto const new_buckets = static_cast<_array_table_bucket<I>*>(new_allocation.storage);
+
+#if vsm_has_address_sanitizer
+		__asan_poison_memory_region(new_buckets, buckets_size);
+#endif
+
+		vsm_except_try
+		{
+			std::uninitialized_copy_n(
+				src_data,
+				size,
+				reinterpret_cast<T*>(_array_table_data(new_buckets, hash_mask)));
+		}
+		vsm_except_catch(...)
+		{
+#if vsm_has_address_sanitizer
+			__asan_unpoison_memory_region(new_buckets, buckets_size);
+#endif
+
+			dst.m_allocator.deallocate(vsm::allocation(new_buckets, storage_size));
+			vsm_except_rethrow;
+		}
+
+		vsm_memcpy_no_sanitize_address(new_buckets, src_buckets, buckets_size);
+
+#if vsm_has_address_sanitizer
+		_array_table_remove_annotation<sizeof(T)>(dst);
+#endif
+
+		_array_table_deallocate(dst, sizeof(T));
+
+		dst._set_storage_ptr(new_buckets);
+		dst._set(hash_mask, /* is_local: */ false);
+	}
+
+	dst.m_size = static_cast<I>(size);
+}
+
+struct _array_table_statistics
+{
+	size_t size;
+	size_t capacity;
+	size_t bucket_count;
+
+	// Largest distance of any bucket from its ideal position.
+	size_t max_displacement;
+
+	// Bucket counts indexed by their distance from their ideal position.
+	_hash_table_histogram displacement_histogram;
+};
+
+template<typename I, typename P>
+_array_table_statistics _array_table_get_statistics(_array_table_with_policies<I, P> const& table)
+{
+	size_t const hash_mask = table.m_hash_mask;
+
+	_array_table_statistics statistics = {};
+	statistics.size = table.m_size;
+	statistics.capacity = _array_table_max_size(hash_mask);
+	statistics.bucket_count = hash_mask == 0 ? 0 : hash_mask + 1;
+
+	if (table.m_size != 0)
+	{
+		_array_table_bucket<I> const* const buckets = table._get_ptr();
+
+		for (size_t bucket_index = 0; bucket_index <= hash_mask; ++bucket_index)
+		{
+			_array_table_bucket<I> const& bucket = buckets[bucket_index];
+
+			if (bucket.load_index() == std::numeric_limits<I>::max())
+			{
+				continue;
+			}
+
+			size_t const displacement = _array_table_bucket_distance(bucket, bucket_index, hash_mask);
+
+			statistics.max_displacement = std::max(statistics.max_displacement, displacement);
+			_hash_table_histogram_add(statistics.displacement_histogram, displacement);
+		}
+	}
+
+	return statistics;
+}
+
 template<typename T, typename I, typename P, typename A>
 void _array_table_swap(
 	_array_table_with_allocator<I, P, A>& lhs,
 	_array_table_with_allocator<I, P, A>& rhs) noexcept;
 
 
-template<typename T, typename K, typename I, typename P, typename A>
+template<typename T, typename K, typename I, typename P, typename A, bool Ordered>
 class _array_table_base_impl : _array_table_with_allocator<I, P, A>
 {
 public:
@@ -916,6 +1146,7 @@ public:
 	using single_iterator               = iterator;
 	using const_single_iterator         = const_iterator;
 	using insert_result                 = vsm::insert_result<iterator>;
+	using statistics_type               = _array_table_statistics;
 
 
 	[[nodiscard]] P const& policies() const noexcept
@@ -967,19 +1198,48 @@ public:
 		}
 	}
 
+	// Reports the distribution of the elements within the table.
+	// The complexity is linear in the capacity of the table.
+	[[nodiscard]] statistics_type statistics() const
+	{
+		return _array_table_get_statistics(*this);
+	}
+
+
+	// Computes the hash of the key as used by the table. The *_with_hash functions require the
+	// hash to have been computed in this way, by this or any other table with equal policies.
+	template<hash_table_key<_array_table_base_impl> Key>
+	[[nodiscard]] size_t hash(Key const& key) const
+	{
+		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
+		decltype(auto) k_canonical = vsm::normalize_key(k);
+		using k_type = remove_ref_t<decltype(k_canonical)>;
+
+		return static_cast<P const&>(this->m_policies)
+			.hasher(static_cast<k_type const&>(k_canonical));
+	}
+
 
 	template<hash_table_key<_array_table_base_impl> Key>
 	[[nodiscard]] iterator find(Key const& key)
+	{
+		return find_with_hash(_array_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_array_table_base_impl> Key>
+	[[nodiscard]] const_single_iterator find(Key const& key) const
+	{
+		return find_with_hash(_array_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_array_table_base_impl> Key>
+	[[nodiscard]] iterator find_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		void* const storage = _array_table_find<sizeof(T), K, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
+		void* const storage = _array_table_find<sizeof(T), K, k_type>(*this, hash, k_canonical);
 
 		return storage == nullptr
 			? end()
@@ -987,17 +1247,13 @@ public:
 	}
 
 	template<hash_table_key<_array_table_base_impl> Key>
-	[[nodiscard]] const_single_iterator find(Key const& key) const
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, Key const& key) const
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		void* const storage = _array_table_find<sizeof(T), K, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
+		void* const storage = _array_table_find<sizeof(T), K, k_type>(*this, hash, k_canonical);
 
 		return storage == nullptr
 			? end()
@@ -1007,24 +1263,34 @@ public:
 
 	template<hash_table_key<_array_table_base_impl> Key>
 	size_t erase(Key const& key)
+	{
+		return erase_with_hash(_array_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_array_table_base_impl> Key>
+	size_t erase_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		auto const result = _array_table_find_1<sizeof(T), K, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
+		auto const result = _array_table_find_1<sizeof(T), K, k_type>(*this, hash, k_canonical);
 
 		if (result.slot == nullptr)
 		{
 			return 0;
 		}
 
-		std::destroy_at(static_cast<T*>(result.slot));
-		_array_table_erase<T>(*this, result.bucket_index);
+		if constexpr (Ordered)
+		{
+			std::destroy_at(static_cast<T*>(result.slot));
+			_array_table_erase<T>(*this, result.bucket_index);
+		}
+		else
+		{
+			// Destroys the element once the last element, which replaces it, has been hashed.
+			_array_table_erase_unordered<T, K>(*this, result.bucket_index);
+		}
 
 		return 1;
 	}
@@ -1062,21 +1328,37 @@ protected:
 
 	template<typename Key>
 	[[nodiscard]] insert_result insert_uninitialized(Key const& key)
+	{
+		return insert_uninitialized_with_hash(_array_table_base_impl::hash(key), key);
+	}
+
+	template<typename Key>
+	[[nodiscard]] insert_result insert_uninitialized_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		auto const [storage, inserted] = _array_table_insert<sizeof(T), Key, k_type>(
+		auto const [storage, inserted] = _array_table_insert<sizeof(T), K, k_type>(
 			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
+			hash,
 			k_canonical,
 			_array_table_resize_3<T, K, I, P, A>);
 
 		return { iterator(static_cast<T*>(storage)), inserted };
 	}
 
+	// Inserts a new element for a key known not to be present in the table. The key is not compared.
+	[[nodiscard]] iterator insert_unique_uninitialized_with_hash(size_t const hash)
+	{
+		void* const storage = _array_table_insert_unique<sizeof(T)>(
+			*this,
+			hash,
+			_array_table_resize_3<T, K, I, P, A>);
+
+		return iterator(static_cast<T*>(storage));
+	}
+
 	template<typename BaseFacade, size_t Capacity>
 	friend class _array_table_impl;
 };
@@ -1100,11 +1382,12 @@ template<
 	typename I,
 	typename P,
 	typename A,
+	bool Ordered,
 	size_t Capacity>
-class _array_table_impl<BaseFacade<_array_table_base_impl<T, K, I, P, A>>, Capacity>
-	: public _array_table_base<BaseFacade<_array_table_base_impl<T, K, I, P, A>>, T, I, P, A, Capacity>
+class _array_table_impl<BaseFacade<_array_table_base_impl<T, K, I, P, A, Ordered>>, Capacity>
+	: public _array_table_base<BaseFacade<_array_table_base_impl<T, K, I, P, A, Ordered>>, T, I, P, A, Capacity>
 {
-	using base = _array_table_base<BaseFacade<_array_table_base_impl<T, K, I, P, A>>, T, I, P, A, Capacity>;
+	using base = _array_table_base<BaseFacade<_array_table_base_impl<T, K, I, P, A, Ordered>>, T, I, P, A, Capacity>;
 
 	static_assert(offsetof(_array_table<I>, m_size) == 0);
 	static_assert(offsetof(base, m_size) + sizeof(_array_table<I>) == offsetof(base, m_storage_ptr));
@@ -1133,6 +1416,25 @@ public:
 		_initialize();
 	}
 
+	template<std::ranges::input_range R>
+		requires requires (base& table, R&& range) { table.insert_range(vsm_forward(range)); }
+	_array_table_impl(std::from_range_t, R&& range)
+	{
+		_initialize();
+		this->insert_range(vsm_forward(range));
+	}
+
+	template<std::ranges::input_range R>
+		requires requires (base& table, R&& range)
+		{
+			table.insert_range(unique_keys, vsm_forward(range));
+		}
+	_array_table_impl(std::from_range_t, unique_keys_t, R&& range)
+	{
+		_initialize();
+		this->insert_range(unique_keys, vsm_forward(range));
+	}
+
 	_array_table_impl(_array_table_impl&& other) noexcept
 		requires allocators::is_propagatable_v<A>
 		: base(other.m_policies, other.m_allocator)
@@ -1161,6 +1463,31 @@ public:
 		return *this;
 	}
 
+	_array_table_impl(_array_table_impl const& other)
+		requires std::is_copy_constructible_v<T>
+		: base(other.m_policies, other.m_allocator)
+	{
+		_initialize();
+		_array_table_copy<T>(*this, other);
+	}
+
+	_array_table_impl& operator=(_array_table_impl const& other) &
+		requires std::is_copy_constructible_v<T>
+	{
+		if (vsm_likely(this != &other))
+		{
+			if (this->m_size != 0)
+			{
+				_array_table_clear<T>(*this);
+			}
+
+			this->m_policies = static_cast<P const&>(other.m_policies);
+			_array_table_copy<T>(*this, other);
+		}
+
+		return *this;
+	}
+
 	~_array_table_impl()
 	{
 		_array_table_destroy<T>(*this);
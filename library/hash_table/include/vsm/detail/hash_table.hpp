@@ -1,11 +1,19 @@
 #pragma once
 
 #include <vsm/concepts.hpp>
+#include <vsm/exceptions.hpp>
 #include <vsm/key_selector.hpp>
 #include <vsm/standard.hpp>
+#include <vsm/standard/stdexcept.hpp>
 #include <vsm/utility.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
 namespace vsm {
 
@@ -21,8 +29,96 @@ struct hash_table_policies
 	vsm_no_unique_address Comparator comparator;
 };
 
+// Tag indicating that the keys of a range inserted into a hash table are unique, both within the
+// range and with respect to the existing elements of the table. The keys are not compared during
+// insertion. Inserting duplicate keys using this tag results in undefined behaviour.
+struct unique_keys_t
+{
+	explicit unique_keys_t() = default;
+};
+inline constexpr unique_keys_t unique_keys{};
+
 namespace detail {
 
+// Number of entries in the histograms reported by hash table statistics. The last entry also
+// counts all values too large to be represented by the histogram.
+inline constexpr size_t _hash_table_histogram_size = 32;
+
+using _hash_table_histogram = std::array<size_t, _hash_table_histogram_size>;
+
+inline void _hash_table_histogram_add(_hash_table_histogram& histogram, size_t const value)
+{
+	histogram[std::min(value, _hash_table_histogram_size - 1)] += 1;
+}
+
+// Number of elements hashed ahead of their insertion during bulk insertion.
+inline constexpr size_t _hash_table_insert_range_batch_size = 64;
+
+// Invokes insert(hash, element) for each element of the range. For forward ranges the hashes of a
+// whole batch of elements are computed before any of them are inserted. The hash computations of
+// a batch are independent of each other and of the table, which lets them execute in parallel.
+// For contiguous ranges, hash_many(elements, hashes) is used to hash a whole batch at once, if
+// provided.
+template<typename Range, typename Hash, typename Insert, typename HashMany = std::nullptr_t>
+void _hash_table_insert_range(
+	Range&& range,
+	Hash const& hash,
+	Insert const& insert,
+	HashMany const& hash_many = nullptr)
+{
+	auto it = std::ranges::begin(range);
+	auto const end = std::ranges::end(range);
+
+	if constexpr (std::ranges::forward_range<Range>)
+	{
+		size_t hashes[_hash_table_insert_range_batch_size];
+
+		while (it != end)
+		{
+			auto batch_it = it;
+			size_t batch_size = 0;
+
+			if constexpr (
+				!std::is_null_pointer_v<HashMany> &&
+				std::ranges::contiguous_range<Range> &&
+				std::sized_sentinel_for<decltype(end), decltype(it)>)
+			{
+				batch_size = std::min(
+					_hash_table_insert_range_batch_size,
+					static_cast<size_t>(end - it));
+
+				hash_many(
+					std::span<std::ranges::range_value_t<Range> const>(
+						std::to_address(it),
+						batch_size),
+					std::span<size_t>(hashes, batch_size));
+
+				it += static_cast<std::ranges::range_difference_t<Range>>(batch_size);
+			}
+			else
+			{
+				for (; batch_size < _hash_table_insert_range_batch_size && it != end; ++it)
+				{
+					hashes[batch_size++] = hash(*it);
+				}
+			}
+
+			for (size_t i = 0; i < batch_size; ++i, ++batch_it)
+			{
+				insert(hashes[i], *batch_it);
+			}
+		}
+	}
+	else
+	{
+		for (; it != end; ++it)
+		{
+			decltype(auto) element = *it;
+			insert(hash(element), vsm_forward(element));
+		}
+	}
+}
+
 template<typename Key, typename KeySelector, typename K>
 inline vsm_always_inline decltype(auto) get_lookup_key(
 	KeySelector const& key_selector,
@@ -55,6 +151,104 @@ concept hash_table_key = requires (Key const& key, typename Table::policies_type
 	{ get_lookup_key<typename Table::key_type>(p.key_selector, key) } -> _hash_table_key<Table>;
 };
 
+template<typename K, typename Map>
+concept _hash_map_lookup_key = requires (Map& map, K const& key)
+{
+	map.find(key) != map.end();
+};
+
+template<typename K, typename Map>
+concept _hash_map_lookup_lvalue_key =
+	_hash_map_lookup_key<K, Map> &&
+	requires (Map& map, K const& key)
+	{
+		requires std::is_lvalue_reference_v<decltype(*map.find(key))>;
+	};
+
+// Implements the lookup functions of a hash map in terms of the find and end member functions of
+// the derived class Map. The overloads available for non-const and const maps follow those of
+// Map::find, and find_ptr is only available if the iterators of Map yield lvalue references. The
+// functions are usable in constant expressions if Map::find is.
+template<typename Map>
+class hash_map_lookup_facade
+{
+public:
+	template<_hash_map_lookup_lvalue_key<Map> K>
+	[[nodiscard]] constexpr auto* find_ptr(K const& key)
+	{
+		return _find_ptr(static_cast<Map&>(*this), key);
+	}
+
+	template<_hash_map_lookup_lvalue_key<Map const> K>
+	[[nodiscard]] constexpr auto* find_ptr(K const& key) const
+	{
+		return _find_ptr(static_cast<Map const&>(*this), key);
+	}
+
+	template<_hash_map_lookup_key<Map> K>
+	[[nodiscard]] constexpr auto& at(K const& key)
+	{
+		return _at(static_cast<Map&>(*this), key);
+	}
+
+	template<_hash_map_lookup_key<Map const> K>
+	[[nodiscard]] constexpr auto& at(K const& key) const
+	{
+		return _at(static_cast<Map const&>(*this), key);
+	}
+
+	template<_hash_map_lookup_key<Map> K>
+	[[nodiscard]] constexpr auto* at_ptr(K const& key)
+	{
+		return _at_ptr(static_cast<Map&>(*this), key);
+	}
+
+	template<_hash_map_lookup_key<Map const> K>
+	[[nodiscard]] constexpr auto* at_ptr(K const& key) const
+	{
+		return _at_ptr(static_cast<Map const&>(*this), key);
+	}
+
+	template<_hash_map_lookup_key<Map const> K>
+	[[nodiscard]] constexpr size_t count(K const& key) const
+	{
+		return contains(key);
+	}
+
+	template<_hash_map_lookup_key<Map const> K>
+	[[nodiscard]] constexpr bool contains(K const& key) const
+	{
+		Map const& map = static_cast<Map const&>(*this);
+		return map.find(key) != map.end();
+	}
+
+private:
+	template<typename Self, typename K>
+	[[nodiscard]] static constexpr auto* _find_ptr(Self& map, K const& key)
+	{
+		auto const it = map.find(key);
+		return it != map.end() ? &*it : nullptr;
+	}
+
+	template<typename Self, typename K>
+	[[nodiscard]] static constexpr auto& _at(Self& map, K const& key)
+	{
+		auto const it = map.find(key);
+		if (it == map.end())
+		{
+			vsm_except_throw_or_terminate(std::out_of_range("hash map key not found"));
+		}
+		return it->value;
+	}
+
+	template<typename Self, typename K>
+	[[nodiscard]] static constexpr auto* _at_ptr(Self& map, K const& key)
+	{
+		auto const it = map.find(key);
+		return it != map.end() ? &it->value : nullptr;
+	}
+};
+
 template<typename Base, typename P>
 struct hash_table_policies_layout : Base
 {
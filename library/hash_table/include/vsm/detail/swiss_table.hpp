@@ -1,8 +1,10 @@
 #pragma once
 
 #include <vsm/allocator.hpp>
+#include <vsm/assert.h>
 #include <vsm/concepts.hpp>
 #include <vsm/detail/hash_table.hpp>
+#include <vsm/exceptions.hpp>
 #include <vsm/insert_result.hpp>
 #include <vsm/key_value_pair.hpp>
 #include <vsm/platform.h>
@@ -14,7 +16,54 @@
 
 #include <array>
 #include <bit>
+#include <exception>
 #include <limits>
+#include <ranges>
+#include <span>
+
+namespace vsm {
+
+// Tombstone policy which never rehashes the table on erasure.
+struct no_tombstone_rehash
+{
+	[[nodiscard]] static constexpr float max_tombstone_ratio() noexcept
+	{
+		return 0;
+	}
+};
+
+// Tombstone policy which rehashes the table in place when the fraction of slots occupied by
+// tombstones exceeds a ratio specified at runtime. Zero, the default, disables this.
+class max_tombstone_ratio_rehash
+{
+	float m_max_tombstone_ratio = 0;
+
+public:
+	[[nodiscard]] float max_tombstone_ratio() const noexcept
+	{
+		return m_max_tombstone_ratio;
+	}
+
+	void set_max_tombstone_ratio(float const max_tombstone_ratio) noexcept
+	{
+		vsm_assert(max_tombstone_ratio >= 0 && max_tombstone_ratio <= 1);
+		m_max_tombstone_ratio = max_tombstone_ratio;
+	}
+};
+
+template<
+	typename KeySelector,
+	typename Hasher,
+	typename Comparator,
+	typename TombstonePolicy = no_tombstone_rehash>
+struct swiss_table_policies : hash_table_policies<KeySelector, Hasher, Comparator>
+{
+	using tombstone_policy_type = TombstonePolicy;
+
+	vsm_no_unique_address TombstonePolicy tombstone_policy;
+};
+
+} // namespace vsm
 
 namespace vsm::detail {
 
@@ -247,7 +296,136 @@ private:
 };
 #endif
 
-#if vsm_arch_x86
+#if vsm_arch_x86_avx2
+class _swiss_table_group_avx2
+{
+	using iterator_type = _swiss_table_bitmask<uint32_t>;
+
+	__m256i m_ctrl;
+
+public:
+	static constexpr size_t size = 32;
+
+	explicit _swiss_table_group_avx2(_swiss_table_ctrl const* const ctrl)
+		: m_ctrl(_swiss_table_group_avx2::load(ctrl))
+	{
+	}
+
+	[[nodiscard]] iterator_type match(_swiss_table_ctrl const hash_2) const
+	{
+		__m256i const v_hash_2 = _mm256_set1_epi8(static_cast<int8_t>(hash_2));
+		return iterator_type(static_cast<uint32_t>(
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(v_hash_2, m_ctrl))));
+	}
+
+	[[nodiscard]] iterator_type match_empty() const
+	{
+		return iterator_type(static_cast<uint32_t>(
+			_mm256_movemask_epi8(_mm256_sign_epi8(m_ctrl, m_ctrl))));
+	}
+
+	[[nodiscard]] iterator_type match_free() const
+	{
+		__m256i const v_end = _mm256_set1_epi8(static_cast<int8_t>(_swiss_table_ctrl::end));
+		return iterator_type(static_cast<uint32_t>(
+			_mm256_movemask_epi8(_mm256_cmpgt_epi8(v_end, m_ctrl))));
+	}
+
+	[[nodiscard]] size_t count_leading_free_or_end() const
+	{
+		__m256i const v_end = _mm256_set1_epi8(static_cast<int8_t>(_swiss_table_ctrl::end));
+		uint32_t const mask = static_cast<uint32_t>(
+			_mm256_movemask_epi8(_mm256_cmpgt_epi8(v_end, m_ctrl)));
+		return static_cast<size_t>(std::countr_one(mask));
+	}
+
+	static void convert_special_to_empty_and_full_to_tomb(_swiss_table_ctrl* group);
+
+private:
+	vsm_no_sanitize_address
+	[[nodiscard]] static vsm_always_inline __m256i load(
+		_swiss_table_ctrl const* const ctrl) noexcept
+	{
+		return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ctrl));
+	}
+
+	vsm_no_sanitize_address
+	static void vsm_always_inline store(
+		_swiss_table_ctrl* const ctrl,
+		__m256i const v_ctrl) noexcept
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(ctrl), v_ctrl);
+	}
+};
+#endif
+
+#if vsm_arch_x86_avx512bw
+class _swiss_table_group_avx512
+{
+	using iterator_type = _swiss_table_bitmask<uint64_t>;
+
+	__m512i m_ctrl;
+
+public:
+	static constexpr size_t size = 64;
+
+	explicit _swiss_table_group_avx512(_swiss_table_ctrl const* const ctrl)
+		: m_ctrl(_swiss_table_group_avx512::load(ctrl))
+	{
+	}
+
+	[[nodiscard]] iterator_type match(_swiss_table_ctrl const hash_2) const
+	{
+		__m512i const v_hash_2 = _mm512_set1_epi8(static_cast<char>(hash_2));
+		return iterator_type(static_cast<uint64_t>(_mm512_cmpeq_epi8_mask(v_hash_2, m_ctrl)));
+	}
+
+	[[nodiscard]] iterator_type match_empty() const
+	{
+		__m512i const v_empty = _mm512_set1_epi8(static_cast<char>(_swiss_table_ctrl::empty));
+		return iterator_type(static_cast<uint64_t>(_mm512_cmpeq_epi8_mask(v_empty, m_ctrl)));
+	}
+
+	[[nodiscard]] iterator_type match_free() const
+	{
+		__m512i const v_end = _mm512_set1_epi8(static_cast<char>(_swiss_table_ctrl::end));
+		return iterator_type(static_cast<uint64_t>(_mm512_cmpgt_epi8_mask(v_end, m_ctrl)));
+	}
+
+	[[nodiscard]] size_t count_leading_free_or_end() const
+	{
+		__m512i const v_end = _mm512_set1_epi8(static_cast<char>(_swiss_table_ctrl::end));
+		uint64_t const mask = static_cast<uint64_t>(_mm512_cmpgt_epi8_mask(v_end, m_ctrl));
+		return static_cast<size_t>(std::countr_one(mask));
+	}
+
+	static void convert_special_to_empty_and_full_to_tomb(_swiss_table_ctrl* group);
+
+private:
+	vsm_no_sanitize_address
+	[[nodiscard]] static vsm_always_inline __m512i load(
+		_swiss_table_ctrl const* const ctrl) noexcept
+	{
+		return _mm512_loadu_si512(ctrl);
+	}
+
+	vsm_no_sanitize_address
+	static void vsm_always_inline store(
+		_swiss_table_ctrl* const ctrl,
+		__m512i const v_ctrl) noexcept
+	{
+		_mm512_storeu_si512(ctrl, v_ctrl);
+	}
+};
+#endif
+
+// The widest group supported by the target is used. Wider groups allow each probe to inspect more
+// slots, reducing the number of probes required for lookups in large tables with high load.
+#if vsm_arch_x86_avx512bw
+using _swiss_table_group = _swiss_table_group_avx512;
+#elif vsm_arch_x86_avx2
+using _swiss_table_group = _swiss_table_group_avx2;
+#elif vsm_arch_x86
 using _swiss_table_group = _swiss_table_group_x86;
 #else
 using _swiss_table_group = _swiss_table_group_generic<size_t>;
@@ -375,6 +553,9 @@ struct _swiss_table
 	}
 };
 
+// The table header is kept to three words. Any further state belongs in the policies.
+static_assert(sizeof(_swiss_table) == 3 * sizeof(size_t));
+
 template<typename P>
 struct _swiss_table_policies
 {
@@ -574,14 +755,13 @@ inline void _swiss_table_ctrl_set_2(
 }
 
 template<size_t SizeofT, typename TK, typename UK, typename P>
-std::pair<void*, size_t> _swiss_table_find_1(
-	_swiss_table_with_policies<P> const& table,
+std::pair<void*, size_t> _swiss_table_find_2(
+	P const& policies,
+	unsigned char* const data,
+	size_t const capacity,
 	size_t const hash,
 	input_t<UK> key)
 {
-	size_t const capacity = table.m_capacity;
-
-	unsigned char* const data = table._get_ptr();
 	_swiss_table_ctrl* const ctrl = _swiss_table_ctrl_ptr(data, capacity, SizeofT);
 
 	_swiss_table_ctrl const hash_2 = _swiss_table_hash_2(hash);
@@ -596,11 +776,9 @@ std::pair<void*, size_t> _swiss_table_find_1(
 			size_t const slot_index = probe.get_offset(mask_index);
 			void* const slot = data + slot_index * SizeofT;
 
-			bool const is_equal = static_cast<P const&>(table.m_policies).comparator(
+			bool const is_equal = policies.comparator(
 				key,
-				vsm::normalize_key(
-					static_cast<P const&>(table.m_policies)
-						.key_selector(*reinterpret_cast<TK const*>(slot))));
+				vsm::normalize_key(policies.key_selector(*reinterpret_cast<TK const*>(slot))));
 
 			if (vsm_likely(is_equal))
 			{
@@ -617,14 +795,77 @@ std::pair<void*, size_t> _swiss_table_find_1(
 	}
 }
 
+template<size_t SizeofT, typename TK, typename UK, typename P>
+std::pair<void*, size_t> _swiss_table_find_1(
+	_swiss_table_with_policies<P> const& table,
+	size_t const hash,
+	input_t<UK> key)
+{
+	return _swiss_table_find_2<SizeofT, TK, UK>(
+		static_cast<P const&>(table.m_policies),
+		table._get_ptr(),
+		table.m_capacity,
+		hash,
+		key);
+}
+
 template<size_t SizeofT, typename TK, typename UK, typename P>
 void* _swiss_table_find(_swiss_table_with_policies<P> const& table, size_t const hash, input_t<UK> key)
 {
 	return _swiss_table_find_1<SizeofT, TK, UK>(table, hash, key).first;
 }
 
+inline vsm_always_inline void _swiss_table_prefetch(void const* const address)
+{
+#if vsm_arch_x86
+	_mm_prefetch(static_cast<char const*>(address), _MM_HINT_T0);
+#endif
+}
+
+// Prefetches the first control group probed when looking up the hash.
+inline void _swiss_table_prefetch_group(
+	_swiss_table const& table,
+	size_t const sizeof_t,
+	size_t const hash)
+{
+	size_t const capacity = table.m_capacity;
+	_swiss_table_ctrl const* const ctrl = _swiss_table_ctrl_ptr(table._get_ptr(), capacity, sizeof_t);
+	_swiss_table_prefetch(ctrl + (_swiss_table_hash_1(hash) & capacity));
+}
+
+// Prefetches the first slot in the first probed control group matching the hash.
+inline void _swiss_table_prefetch_slot(
+	_swiss_table const& table,
+	size_t const sizeof_t,
+	size_t const hash)
+{
+	size_t const capacity = table.m_capacity;
+
+	unsigned char* const data = table._get_ptr();
+	_swiss_table_ctrl const* const ctrl = _swiss_table_ctrl_ptr(data, capacity, sizeof_t);
+
+	_swiss_table_probe const probe(_swiss_table_hash_1(hash), capacity);
+	_swiss_table_group const group(ctrl + probe.offset);
+
+	if (auto const mask = group.match(_swiss_table_hash_2(hash)))
+	{
+		_swiss_table_prefetch(data + probe.get_offset(mask.countr_zero()) * sizeof_t);
+	}
+}
+
+// Number of keys between the software pipeline stages of batched lookup.
+inline constexpr size_t _swiss_table_prefetch_distance = 8;
+
 size_t _swiss_table_find_free(_swiss_table_ctrl const* ctrl, size_t capacity, size_t hash);
 
+// Like _swiss_table_find_free, but only probes groups lying entirely within the aligned block of
+// block_size slots containing the first probed slot. Returns -1 if no free slot is found there.
+size_t _swiss_table_find_free_in_block(
+	_swiss_table_ctrl const* ctrl,
+	size_t capacity,
+	size_t hash,
+	size_t block_size);
+
 void _swiss_table_refresh_1(_swiss_table_ctrl* ctrl, size_t capacity);
 
 inline size_t _swiss_table_probe_index(
@@ -635,6 +876,23 @@ inline size_t _swiss_table_probe_index(
 	return ((slot_index - _swiss_table_hash_1(hash)) & capacity) / _swiss_table_group_size;
 }
 
+// Returns the number of groups probed when looking up the element in the specified slot.
+inline size_t _swiss_table_probe_length(
+	size_t const capacity,
+	size_t const slot_index,
+	size_t const hash)
+{
+	_swiss_table_probe probe(_swiss_table_hash_1(hash), capacity);
+
+	size_t length = 1;
+	while (((slot_index - probe.offset) & capacity) >= _swiss_table_group_size)
+	{
+		probe.next();
+		++length;
+	}
+	return length;
+}
+
 template<typename T, typename K, typename P>
 void _swiss_table_refresh(_swiss_table_with_policies<P>& table)
 {
@@ -647,7 +905,8 @@ void _swiss_table_refresh(_swiss_table_with_policies<P>& table)
 
 	for (size_t old_index = 0; old_index < capacity; ++old_index)
 	{
-		if (_swiss_table_ctrl_get(ctrl, old_index) == _swiss_table_ctrl::tomb)
+		// After _swiss_table_refresh_1, the slots still to be rehashed are marked as tombs.
+		if (_swiss_table_ctrl_get(ctrl, old_index) != _swiss_table_ctrl::tomb)
 		{
 			continue;
 		}
@@ -704,6 +963,36 @@ void _swiss_table_refresh(_swiss_table_with_policies<P>& table)
 	table.m_free = _swiss_table_max_size(capacity) - table.m_size;
 }
 
+template<typename T>
+void _swiss_table_rehash_1(
+	unsigned char* const old_slot,
+	unsigned char* const new_data,
+	_swiss_table_ctrl* const new_ctrl,
+	size_t const new_capacity,
+	size_t const new_slot_index,
+	size_t const hash)
+{
+	_swiss_table_ctrl_set_2(new_ctrl, new_capacity, new_slot_index, _swiss_table_hash_2(hash));
+	unsigned char* const new_slot = new_data + new_slot_index * sizeof(T);
+
+#if vsm_has_address_sanitizer
+	__asan_unpoison_memory_region(new_slot, sizeof(T));
+#endif
+
+	vsm::relocate_at(reinterpret_cast<T*>(old_slot), reinterpret_cast<T*>(new_slot));
+
+#if vsm_has_address_sanitizer
+	__asan_poison_memory_region(old_slot, sizeof(T));
+#endif
+}
+
+template<typename K, typename P>
+size_t _swiss_table_rehash_hash(P const& policies, unsigned char const* const slot)
+{
+	return policies.hasher(vsm::normalize_key(
+		policies.key_selector(*reinterpret_cast<K const*>(slot))));
+}
+
 template<typename T, typename K, typename P>
 void _swiss_table_rehash(
 	_swiss_table_with_policies<P>& old_table,
@@ -727,25 +1016,172 @@ void _swiss_table_rehash(
 
 		unsigned char* const old_slot = old_data + old_slot_index * sizeof(T);
 
-		size_t const hash = static_cast<P const&>(old_table.m_policies)
-			.hasher(vsm::normalize_key(
-				static_cast<P const&>(old_table.m_policies)
-					.key_selector(*reinterpret_cast<K const*>(old_slot))));
+		size_t const hash = _swiss_table_rehash_hash<K>(
+			static_cast<P const&>(old_table.m_policies),
+			old_slot);
 
 		size_t const new_slot_index = _swiss_table_find_free(new_ctrl, new_capacity, hash);
-		_swiss_table_ctrl_set_2(new_ctrl, new_capacity, new_slot_index, _swiss_table_hash_2(hash));
-		unsigned char* const new_slot = new_data + new_slot_index * sizeof(T);
+		_swiss_table_rehash_1<T>(old_slot, new_data, new_ctrl, new_capacity, new_slot_index, hash);
+	}
+}
 
-#if vsm_has_address_sanitizer
-		__asan_unpoison_memory_region(new_slot, sizeof(T));
-#endif
+// Smallest number of slots of the old table processed by each task of a parallel rehash.
+inline constexpr size_t _swiss_table_parallel_min_block_size = 16384;
+inline constexpr size_t _swiss_table_parallel_max_task_count = 64;
 
-		vsm::relocate_at(reinterpret_cast<T*>(old_slot), reinterpret_cast<T*>(new_slot));
+struct _swiss_table_parallel_task
+{
+	static constexpr size_t max_deferred_count = 32;
 
-#if vsm_has_address_sanitizer
-		__asan_poison_memory_region(old_slot, sizeof(T));
-#endif
+	size_t deferred_count;
+	size_t deferred[max_deferred_count];
+};
+
+// Rehashes the elements using tasks submitted to the executor. The old table is divided into
+// task_count blocks of equal size, and the new table, which must not be smaller, into blocks of
+// the same size. Because both capacities are powers of two minus one, an element whose probe
+// sequence starts in old block i starts in a new block congruent to i modulo task_count. Task i
+// owns all such new blocks and inserts the elements of old block i which start in old block i and
+// find a free slot without probing outside of their new block. The remaining elements, displaced
+// across a block boundary in either table, are deferred and inserted sequentially once all tasks
+// have completed.
+//
+// If the executor throws, the elements not yet relocated by the tasks are rehashed sequentially,
+// leaving the new table complete, and the exception is returned to the caller for rethrowing once
+// the new table has been installed.
+template<typename T, typename K, typename P, typename Executor>
+std::exception_ptr _swiss_table_rehash_parallel(
+	_swiss_table_with_policies<P>& old_table,
+	_swiss_table& new_table,
+	unsigned char* const new_data,
+	Executor&& executor)
+{
+	size_t const old_capacity = old_table.m_capacity;
+	size_t const new_capacity = new_table.m_capacity;
+
+	size_t const task_count = std::min(
+		(old_capacity + 1) / _swiss_table_parallel_min_block_size,
+		_swiss_table_parallel_max_task_count);
+
+	if (task_count < 2 || new_capacity < old_capacity)
+	{
+		_swiss_table_rehash<T, K, P>(old_table, new_table, new_data);
+		return nullptr;
+	}
+
+	size_t const block_size = (old_capacity + 1) / task_count;
+
+	unsigned char* const old_data = old_table._get_ptr();
+
+	_swiss_table_ctrl* const old_ctrl = _swiss_table_ctrl_ptr(old_data, old_capacity, sizeof(T));
+	_swiss_table_ctrl* const new_ctrl = _swiss_table_ctrl_ptr(new_data, new_capacity, sizeof(T));
+
+	P const& policies = static_cast<P const&>(old_table.m_policies);
+
+	_swiss_table_parallel_task tasks[_swiss_table_parallel_max_task_count];
+
+	auto const rehash_block = [&](size_t const task_index)
+	{
+		_swiss_table_parallel_task& task = tasks[task_index];
+		task.deferred_count = 0;
+
+		size_t const old_slot_end = (task_index + 1) * block_size;
+
+		for (size_t old_slot_index = task_index * block_size;
+			old_slot_index < old_slot_end;
+			++old_slot_index)
+		{
+			if (_swiss_table_ctrl_get(old_ctrl, old_slot_index) < static_cast<_swiss_table_ctrl>(0))
+			{
+				continue;
+			}
+
+			unsigned char* const old_slot = old_data + old_slot_index * sizeof(T);
+			size_t const hash = _swiss_table_rehash_hash<K>(policies, old_slot);
+
+			size_t new_slot_index = static_cast<size_t>(-1);
+			if ((_swiss_table_hash_1(hash) & old_capacity) / block_size == task_index)
+			{
+				new_slot_index = _swiss_table_find_free_in_block(
+					new_ctrl,
+					new_capacity,
+					hash,
+					block_size);
+			}
+
+			if (new_slot_index == static_cast<size_t>(-1))
+			{
+				if (task.deferred_count < task.max_deferred_count)
+				{
+					task.deferred[task.deferred_count] = old_slot_index;
+				}
+				++task.deferred_count;
+				continue;
+			}
+
+			_swiss_table_rehash_1<T>(
+				old_slot,
+				new_data,
+				new_ctrl,
+				new_capacity,
+				new_slot_index,
+				hash);
+
+			// Mark the slot as relocated for the sequential pass.
+			_swiss_table_ctrl_set_1(old_ctrl, old_slot_index, _swiss_table_ctrl::empty);
+		}
+	};
+
+	vsm_except_try
+	{
+		vsm_forward(executor)(task_count, rehash_block);
+	}
+	vsm_except_catch(...)
+	{
+		// Relocated elements are marked empty in the old table, so any element still present in
+		// the old table was either deferred or belongs to a task which never ran.
+		_swiss_table_rehash<T, K, P>(old_table, new_table, new_data);
+		return std::current_exception();
+	}
+
+	auto const rehash_deferred = [&](size_t const old_slot_index)
+	{
+		unsigned char* const old_slot = old_data + old_slot_index * sizeof(T);
+		size_t const hash = _swiss_table_rehash_hash<K>(policies, old_slot);
+
+		size_t const new_slot_index = _swiss_table_find_free(new_ctrl, new_capacity, hash);
+		_swiss_table_rehash_1<T>(old_slot, new_data, new_ctrl, new_capacity, new_slot_index, hash);
+	};
+
+	for (size_t task_index = 0; task_index < task_count; ++task_index)
+	{
+		_swiss_table_parallel_task const& task = tasks[task_index];
+
+		if (task.deferred_count <= task.max_deferred_count)
+		{
+			for (size_t i = 0; i < task.deferred_count; ++i)
+			{
+				rehash_deferred(task.deferred[i]);
+			}
+		}
+		else
+		{
+			// Too many elements were deferred to remember them all. Any element still remaining in
+			// the old block was deferred.
+			size_t const old_slot_begin = task_index * block_size;
+			size_t const old_slot_end = old_slot_begin + block_size;
+
+			for (size_t i = old_slot_begin; i < old_slot_end; ++i)
+			{
+				if (_swiss_table_ctrl_get(old_ctrl, i) >= static_cast<_swiss_table_ctrl>(0))
+				{
+					rehash_deferred(i);
+				}
+			}
+		}
 	}
+
+	return nullptr;
 }
 
 template<typename A>
@@ -806,8 +1242,11 @@ void _swiss_table_deallocate(_swiss_table_with_allocator<P, A>& table, size_t co
 	}
 }
 
-template<typename T, typename K, typename P, typename A>
-void _swiss_table_resize_1(_swiss_table_with_allocator<P, A>& table, size_t new_capacity)
+template<typename T, typename K, typename P, typename A, typename Rehash>
+void _swiss_table_resize_1(
+	_swiss_table_with_allocator<P, A>& table,
+	size_t new_capacity,
+	Rehash&& rehash)
 {
 	vsm_assert(std::has_single_bit(new_capacity + 1));
 	vsm_assert(_swiss_table_max_size(new_capacity) >= table.m_size);
@@ -833,7 +1272,7 @@ void _swiss_table_resize_1(_swiss_table_with_allocator<P, A>& table, size_t new_
 
 	if (size != 0)
 	{
-		_swiss_table_rehash<T, K, P>(table, new_table, new_data);
+		vsm_forward(rehash)(table, new_table, new_data);
 	}
 
 	_swiss_table_deallocate(table, sizeof(T));
@@ -842,6 +1281,12 @@ void _swiss_table_resize_1(_swiss_table_with_allocator<P, A>& table, size_t new_
 	table._set_storage_ptr(new_data);
 }
 
+template<typename T, typename K, typename P, typename A>
+void _swiss_table_resize_1(_swiss_table_with_allocator<P, A>& table, size_t const new_capacity)
+{
+	_swiss_table_resize_1<T, K>(table, new_capacity, _swiss_table_rehash<T, K, P>);
+}
+
 template<typename T, typename K, typename P, typename A>
 void _swiss_table_resize_2(_swiss_table_with_allocator<P, A>& table)
 {
@@ -878,11 +1323,41 @@ void _swiss_table_reserve(_swiss_table_with_allocator<P, A>& table, size_t const
 	_swiss_table_resize_1<T, K>(table, _swiss_table_min_capacity_for(min_capacity));
 }
 
-using _swiss_table_resize_t = void(_swiss_table& table);
+template<typename T, typename K, typename P, typename A, typename Executor>
+void _swiss_table_reserve(
+	_swiss_table_with_allocator<P, A>& table,
+	size_t const min_capacity,
+	Executor&& executor)
+{
+	vsm_assert(min_capacity > _swiss_table_max_size(table.m_capacity));
 
-void* _swiss_table_insert_1(
-	_swiss_table& table,
-	size_t sizeof_t,
+	std::exception_ptr exception;
+	_swiss_table_resize_1<T, K>(
+		table,
+		_swiss_table_min_capacity_for(min_capacity),
+		[&](
+			_swiss_table_with_policies<P>& old_table,
+			_swiss_table& new_table,
+			unsigned char* const new_data)
+		{
+			exception = _swiss_table_rehash_parallel<T, K, P>(
+				old_table,
+				new_table,
+				new_data,
+				vsm_forward(executor));
+		});
+
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+}
+
+using _swiss_table_resize_t = void(_swiss_table& table);
+
+void* _swiss_table_insert_1(
+	_swiss_table& table,
+	size_t sizeof_t,
 	size_t hash,
 	_swiss_table_resize_t* resize);
 
@@ -905,17 +1380,173 @@ insert_result<void*> _swiss_table_insert(
 
 void _swiss_table_erase_1(_swiss_table& table, size_t sizeof_t, size_t slot_index);
 
-template<size_t SizeofT, typename TK, typename UK, typename P>
-void* _swiss_table_erase(_swiss_table_with_policies<P>& table, size_t const hash, input_t<UK> key)
+template<typename T, typename TK, typename UK, typename P>
+bool _swiss_table_erase(_swiss_table_with_policies<P>& table, size_t const hash, input_t<UK> key)
 {
-	auto const [slot, slot_index] = _swiss_table_find_1<SizeofT, TK, UK>(table, hash, key);
+	auto const [slot, slot_index] = _swiss_table_find_1<sizeof(T), TK, UK>(table, hash, key);
 
-	if (slot != nullptr)
+	if (slot == nullptr)
 	{
-		_swiss_table_erase_1(table, SizeofT, slot_index);
+		return false;
 	}
 
-	return slot;
+	// The element must be destroyed before the slot is erased and poisoned.
+	std::destroy_at(static_cast<T*>(slot));
+	_swiss_table_erase_1(table, sizeof(T), slot_index);
+
+	return true;
+}
+
+inline size_t _swiss_table_tomb_count(_swiss_table const& table)
+{
+	return _swiss_table_max_size(table.m_capacity) - table.m_size - table.m_free;
+}
+
+template<typename T, typename K, typename P>
+void _swiss_table_refresh_if_tomb_ratio_exceeded(_swiss_table_with_policies<P>& table)
+{
+	float const max_tomb_ratio = table.m_policies.tombstone_policy.max_tombstone_ratio();
+
+	if (max_tomb_ratio != 0)
+	{
+		float const tomb_count = static_cast<float>(_swiss_table_tomb_count(table));
+
+		if (tomb_count > max_tomb_ratio * static_cast<float>(table.m_capacity))
+		{
+			_swiss_table_refresh<T, K>(table);
+		}
+	}
+}
+
+// Invokes the callback with the probe length of each element in the table.
+template<typename T, typename K, typename P, typename Callback>
+void _swiss_table_for_each_probe_length(
+	_swiss_table_with_policies<P> const& table,
+	Callback&& callback)
+{
+	size_t const capacity = table.m_capacity;
+
+	unsigned char* const data = table._get_ptr();
+	_swiss_table_ctrl const* const ctrl = _swiss_table_ctrl_ptr(data, capacity, sizeof(T));
+
+	for (size_t slot_index = 0; slot_index < capacity; ++slot_index)
+	{
+		if (_swiss_table_ctrl_get(ctrl, slot_index) < static_cast<_swiss_table_ctrl>(0))
+		{
+			continue;
+		}
+
+		unsigned char const* const slot = data + slot_index * sizeof(T);
+
+		size_t const hash = static_cast<P const&>(table.m_policies)
+			.hasher(vsm::normalize_key(
+				static_cast<P const&>(table.m_policies)
+					.key_selector(*reinterpret_cast<K const*>(slot))));
+
+		callback(_swiss_table_probe_length(capacity, slot_index, hash));
+	}
+}
+
+struct _swiss_table_statistics
+{
+	size_t size;
+	size_t capacity;
+	size_t slot_count;
+	size_t tombstone_count;
+
+	// Number of groups probed by the lookup with the longest probe sequence.
+	size_t max_probe_length;
+
+	// Element counts indexed by the number of groups probed to find the element, minus one.
+	_hash_table_histogram probe_length_histogram;
+
+	// Group counts indexed by the number of elements within the group. Groups are aligned to the
+	// group size and thus do not necessarily correspond to probed groups.
+	std::array<size_t, _swiss_table_group_size + 1> group_occupancy_histogram;
+};
+
+template<typename T, typename K, typename P>
+_swiss_table_statistics _swiss_table_get_statistics(_swiss_table_with_policies<P> const& table)
+{
+	size_t const capacity = table.m_capacity;
+
+	_swiss_table_statistics statistics = {};
+	statistics.size = table.m_size;
+	statistics.capacity = _swiss_table_max_size(capacity);
+	statistics.slot_count = capacity;
+	statistics.tombstone_count = _swiss_table_tomb_count(table);
+
+	_swiss_table_for_each_probe_length<T, K>(table, [&](size_t const probe_length)
+	{
+		statistics.max_probe_length = std::max(statistics.max_probe_length, probe_length);
+		_hash_table_histogram_add(statistics.probe_length_histogram, probe_length - 1);
+	});
+
+	if (capacity != 0)
+	{
+		_swiss_table_ctrl const* const ctrl = _swiss_table_ctrl_ptr(
+			table._get_ptr(),
+			capacity,
+			sizeof(T));
+
+		for (size_t group_index = 0; group_index < capacity; group_index += _swiss_table_group_size)
+		{
+			size_t const group_end = std::min(group_index + _swiss_table_group_size, capacity);
+
+			size_t occupancy = 0;
+			for (size_t slot_index = group_index; slot_index < group_end; ++slot_index)
+			{
+				occupancy += _swiss_table_ctrl_get(ctrl, slot_index) >= static_cast<_swiss_table_ctrl>(0);
+			}
+
+			statistics.group_occupancy_histogram[occupancy] += 1;
+		}
+	}
+
+	return statistics;
+}
+
+// Relocates the elements in the slots [slot_index, slot_index + slot_count) of src into dst.
+// Returns the index of the first slot not yet migrated.
+template<typename T, typename K, typename P, typename A>
+size_t _swiss_table_migrate(
+	_swiss_table_with_allocator<P, A>& src,
+	_swiss_table_with_allocator<P, A>& dst,
+	size_t slot_index,
+	size_t const slot_count)
+{
+	size_t const capacity = src.m_capacity;
+
+	unsigned char* const data = src._get_ptr();
+	_swiss_table_ctrl* const ctrl = _swiss_table_ctrl_ptr(data, capacity, sizeof(T));
+
+	size_t const end_index = std::min(slot_index + slot_count, capacity);
+
+	for (; slot_index < end_index; ++slot_index)
+	{
+		if (_swiss_table_ctrl_get(ctrl, slot_index) < static_cast<_swiss_table_ctrl>(0))
+		{
+			continue;
+		}
+
+		T* const src_slot = reinterpret_cast<T*>(data + slot_index * sizeof(T));
+
+		size_t const hash = static_cast<P const&>(src.m_policies)
+			.hasher(vsm::normalize_key(
+				static_cast<P const&>(src.m_policies)
+					.key_selector(*reinterpret_cast<K const*>(src_slot))));
+
+		void* const dst_slot = _swiss_table_insert_1(
+			dst,
+			sizeof(T),
+			hash,
+			_swiss_table_resize_3<T, K, P, A>);
+
+		vsm::relocate_at(src_slot, static_cast<T*>(dst_slot));
+		_swiss_table_erase_1(src, sizeof(T), slot_index);
+	}
+
+	return slot_index;
 }
 
 template<typename T>
@@ -1098,6 +1729,133 @@ void _swiss_table_move_assign(
 	_swiss_table_move<T>(dst, src);
 }
 
+template<typename T>
+void _swiss_table_copy_slots(
+	unsigned char* const dst_data,
+	unsigned char const* const src_data,
+	_swiss_table_ctrl const* const ctrl,
+	size_t const capacity)
+{
+#if !vsm_has_address_sanitizer
+	if constexpr (std::is_trivially_copyable_v<T>)
+	{
+		std::memcpy(dst_data, src_data, capacity * sizeof(T));
+	}
+	else
+#endif
+	{
+		size_t slot_index = 0;
+
+		vsm_except_try
+		{
+			for (; slot_index < capacity; ++slot_index)
+			{
+				if (_swiss_table_ctrl_get(ctrl, slot_index) >= static_cast<_swiss_table_ctrl>(0))
+				{
+					T* const dst_slot = reinterpret_cast<T*>(dst_data + slot_index * sizeof(T));
+
+#if vsm_has_address_sanitizer
+					__asan_unpoison_memory_region(dst_slot, sizeof(T));
+#endif
+
+					::new (dst_slot) T(*reinterpret_cast<T const*>(src_data + slot_index * sizeof(T)));
+				}
+			}
+		}
+		vsm_except_catch(...)
+		{
+			for (size_t i = 0; i < slot_index; ++i)
+			{
+				if (_swiss_table_ctrl_get(ctrl, i) >= static_cast<_swiss_table_ctrl>(0))
+				{
+					T* const dst_slot = reinterpret_cast<T*>(dst_data + i * sizeof(T));
+					std::destroy_at(dst_slot);
+
+#if vsm_has_address_sanitizer
+					__asan_poison_memory_region(dst_slot, sizeof(T));
+#endif
+				}
+			}
+			vsm_except_rethrow;
+		}
+	}
+}
+
+// Copies the elements of src into the empty table dst. The control bytes and slots are copied
+// verbatim without rehashing. The existing storage of dst is reused if its capacity is equal.
+// If copying an element throws, dst is left empty.
+template<typename T, typename P, typename A>
+void _swiss_table_copy(
+	_swiss_table_with_allocator<P, A>& dst,
+	_swiss_table_with_allocator<P, A> const& src)
+{
+	vsm_assert(dst.m_size == 0);
+
+	if (src.m_size == 0)
+	{
+		return;
+	}
+
+	size_t const capacity = src.m_capacity;
+	// A non-empty table never uses the empty group.
+	vsm_assume(capacity != 0);
+
+	unsigned char const* const src_data = src._get_ptr();
+	_swiss_table_ctrl const* const src_ctrl = _swiss_table_ctrl_ptr(
+		const_cast<unsigned char*>(src_data),
+		capacity,
+		sizeof(T));
+
+	if (dst.m_capacity == capacity)
+	{
+		unsigned char* const dst_data = dst._get_ptr();
+		_swiss_table_ctrl* const dst_ctrl = _swiss_table_ctrl_ptr(dst_data, capacity, sizeof(T));
+
+		_swiss_table_copy_slots<T>(dst_data, src_data, src_ctrl, capacity);
+		vsm_memcpy_no_sanitize_address(dst_ctrl, src_ctrl, _swiss_table_ctrl_size(capacity));
+	}
+	else
+	{
+		size_t const storage_size = _swiss_table_storage_size(capacity, sizeof(T));
+
+		// The storage is allocated with the exact capacity of src, so that the control bytes
+		// can be copied verbatim.
+		auto const new_allocation = vsm::allocate_or_throw(dst.m_allocator, storage_size);
+		unsigned char* const new_data = static_cast<unsigned char*>(new_allocation.storage);
+
+#if vsm_has_address_sanitizer
+		__asan_poison_memory_region(new_data, storage_size);
+#endif
+
+		vsm_except_try
+		{
+			_swiss_table_copy_slots<T>(new_data, src_data, src_ctrl, capacity);
+		}
+		vsm_except_catch(...)
+		{
+#if vsm_has_address_sanitizer
+			__asan_unpoison_memory_region(new_data, storage_size);
+#endif
+
+			dst.m_allocator.deallocate(vsm::allocation(new_data, storage_size));
+			vsm_except_rethrow;
+		}
+
+		vsm_memcpy_no_sanitize_address(
+			_swiss_table_ctrl_ptr(new_data, capacity, sizeof(T)),
+			src_ctrl,
+			_swiss_table_ctrl_size(capacity));
+
+		_swiss_table_deallocate(dst, sizeof(T));
+
+		dst._set(capacity, /* is_local: */ false);
+		dst._set_storage_ptr(new_data);
+	}
+
+	dst.m_size = src.m_size;
+	dst.m_free = src.m_free;
+}
+
 template<typename T, typename P, typename A>
 void _swiss_table_swap(
 	_swiss_table_with_allocator<P, A>& lhs,
@@ -1171,8 +1929,9 @@ struct _swiss_table_iterator_n_base
 	unsigned char* m_data;
 	_swiss_table_ctrl* m_ctrl;
 
+	// The control bytes are poisoned when the address sanitizer is enabled.
 	template<size_t SizeofT>
-	void skip_free_slots() noexcept
+	vsm_no_sanitize_address void skip_free_slots() noexcept
 	{
 		while (*m_ctrl < _swiss_table_ctrl::end)
 		{
@@ -1304,6 +2063,7 @@ public:
 	using single_iterator               = _swiss_table_iterator_1<T>;
 	using const_single_iterator         = _swiss_table_iterator_1<T const>;
 	using insert_result                 = vsm::insert_result<single_iterator>;
+	using statistics_type               = _swiss_table_statistics;
 
 
 	[[nodiscard]] P const& policies() const noexcept
@@ -1347,6 +2107,23 @@ public:
 		}
 	}
 
+	// Like reserve, but if the table grows, the existing elements are rehashed in parallel. The
+	// executor is invoked as executor(task_count, task), and must invoke task(task_index) for
+	// each task_index in [0, task_count), possibly concurrently, before returning. Small tables
+	// are rehashed sequentially without invoking the executor. If the executor throws, it must
+	// not do so before all tasks it started have completed. The remaining elements are then
+	// rehashed sequentially, and the exception is rethrown with the table already grown.
+	template<typename Executor>
+	void reserve(size_t const min_capacity, Executor&& executor)
+	{
+		static_assert(is_nothrow_relocatable_v<T>);
+
+		if (min_capacity > _swiss_table_max_size(this->m_capacity))
+		{
+			_swiss_table_reserve<T, K>(*this, min_capacity, vsm_forward(executor));
+		}
+	}
+
 	void clear()
 	{
 		if (this->m_size != 0)
@@ -1355,66 +2132,242 @@ public:
 		}
 	}
 
+	// Rehashes the table in place, removing all tombstones left behind by erased elements.
+	void compact()
+	{
+		if (_swiss_table_tomb_count(*this) != 0)
+		{
+			_swiss_table_refresh<T, K>(*this);
+		}
+	}
+
+
+	[[nodiscard]] size_t tombstone_count() const noexcept
+	{
+		return _swiss_table_tomb_count(*this);
+	}
+
+	// Returns the average number of groups probed by successful lookups.
+	// The complexity is linear in the capacity of the table.
+	[[nodiscard]] double average_probe_length() const
+	{
+		if (this->m_size == 0)
+		{
+			return 0;
+		}
+
+		size_t probe_length_sum = 0;
+		_swiss_table_for_each_probe_length<T, K>(*this, [&](size_t const probe_length)
+		{
+			probe_length_sum += probe_length;
+		});
+
+		return static_cast<double>(probe_length_sum) / static_cast<double>(this->m_size);
+	}
+
+	// Reports the distribution of the elements within the table.
+	// The complexity is linear in the capacity of the table.
+	[[nodiscard]] statistics_type statistics() const
+	{
+		return _swiss_table_get_statistics<T, K>(*this);
+	}
+
+	[[nodiscard]] float max_tombstone_ratio() const noexcept
+	{
+		return this->m_policies.tombstone_policy.max_tombstone_ratio();
+	}
+
+	// When the fraction of slots occupied by tombstones exceeds the specified ratio after erasing
+	// an element by key, the table is rehashed in place without growing. Erasing using an iterator
+	// never rehashes the table. Zero, the default, disables this.
+	// Requires the max_tombstone_ratio_rehash tombstone policy.
+	void set_max_tombstone_ratio(float const max_tomb_ratio)
+		requires requires (P& policies) { policies.tombstone_policy.set_max_tombstone_ratio(0.f); }
+	{
+		this->m_policies.tombstone_policy.set_max_tombstone_ratio(max_tomb_ratio);
+	}
+
+
+	// Computes the hash of the key as used by the table. The *_with_hash functions require the
+	// hash to have been computed in this way, by this or any other table with equal policies.
+	template<hash_table_key<_swiss_table_base_impl> Key>
+	[[nodiscard]] size_t hash(Key const& key) const
+	{
+		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
+		decltype(auto) k_canonical = vsm::normalize_key(k);
+		using k_type = remove_ref_t<decltype(k_canonical)>;
+
+		return static_cast<P const&>(this->m_policies)
+			.hasher(static_cast<k_type const&>(k_canonical));
+	}
+
+	// Computes the hash of each key as if by hash. If the keys are used for lookup as they are, and
+	// the hasher provides hash_many, the hashes are computed by the hasher in a single batch.
+	template<hash_table_key<_swiss_table_base_impl> Key>
+	void hash_many(std::span<Key const> const keys, std::span<size_t> const hashes) const
+	{
+		vsm_assert(keys.size() == hashes.size());
+
+		using lookup_key_type = decltype(vsm::normalize_key(detail::get_lookup_key<K>(
+			this->m_policies.key_selector,
+			std::declval<Key const&>())));
+
+		if constexpr (
+			std::is_same_v<lookup_key_type, Key const&> &&
+			requires (P const& p) { p.hasher.hash_many(keys, hashes); })
+		{
+			static_cast<P const&>(this->m_policies).hasher.hash_many(keys, hashes);
+		}
+		else
+		{
+			for (size_t i = 0; i < keys.size(); ++i)
+			{
+				hashes[i] = _swiss_table_base_impl::hash(keys[i]);
+			}
+		}
+	}
+
 
 	template<hash_table_key<_swiss_table_base_impl> Key>
 	[[nodiscard]] single_iterator find(Key const& key)
+	{
+		return find_with_hash(_swiss_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_swiss_table_base_impl> Key>
+	[[nodiscard]] const_single_iterator find(Key const& key) const
+	{
+		return find_with_hash(_swiss_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_swiss_table_base_impl> Key>
+	[[nodiscard]] single_iterator find_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		void* const storage = _swiss_table_find<sizeof(T), K, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
+		void* const storage = _swiss_table_find<sizeof(T), K, k_type>(*this, hash, k_canonical);
 
 		return single_iterator(static_cast<T*>(storage));
 	}
 
 	template<hash_table_key<_swiss_table_base_impl> Key>
-	[[nodiscard]] const_single_iterator find(Key const& key) const
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, Key const& key) const
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		void* const storage = _swiss_table_find<sizeof(T), K, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
+		void* const storage = _swiss_table_find<sizeof(T), K, k_type>(*this, hash, k_canonical);
 
 		return const_single_iterator(static_cast<T const*>(storage));
 	}
 
 
+	// Looks up each key in keys, writing the results to the corresponding elements of results.
+	// Lookups are software pipelined, such that the cache misses of multiple lookups overlap.
+	template<std::ranges::contiguous_range Keys>
+		requires
+			std::ranges::sized_range<Keys> &&
+			hash_table_key<std::ranges::range_value_t<Keys>, _swiss_table_base_impl>
+	void find_many(Keys const& keys, std::span<single_iterator> const results)
+	{
+		_find_many(std::span<std::ranges::range_value_t<Keys> const>(keys), results);
+	}
+
+	template<std::ranges::contiguous_range Keys>
+		requires
+			std::ranges::sized_range<Keys> &&
+			hash_table_key<std::ranges::range_value_t<Keys>, _swiss_table_base_impl>
+	void find_many(Keys const& keys, std::span<const_single_iterator> const results) const
+	{
+		_find_many(std::span<std::ranges::range_value_t<Keys> const>(keys), results);
+	}
+
+
 	template<hash_table_key<_swiss_table_base_impl> Key>
 	size_t erase(Key const& key)
+	{
+		return erase_with_hash(_swiss_table_base_impl::hash(key), key);
+	}
+
+	template<hash_table_key<_swiss_table_base_impl> Key>
+	size_t erase_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		void* const storage = _swiss_table_erase<sizeof(T), Key, k_type>(
-			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
-			k_canonical);
-
-		if (storage == nullptr)
+		if (!_swiss_table_erase<T, K, k_type>(*this, hash, k_canonical))
 		{
 			return 0;
 		}
 
-		std::destroy_at(static_cast<T*>(storage));
+		_swiss_table_refresh_if_tomb_ratio_exceeded<T, K>(*this);
+
 		return 1;
 	}
 
+	// Relocates the elements in the slots [slot_index, slot_index + slot_count) into target, which
+	// must not contain any of the same keys. Returns the index of the first slot not yet migrated.
+	// The migration is complete once the returned index is equal to _slot_count().
+	size_t _migrate(_swiss_table_base_impl& target, size_t const slot_index, size_t const slot_count)
+	{
+		return _swiss_table_migrate<T, K>(*this, target, slot_index, slot_count);
+	}
+
+	// Inserts an uninitialized slot for the key if it is not already present. If a slot is
+	// inserted, the caller must construct an element in it, or release it using
+	// _erase_uninitialized.
+	template<typename Key>
+	[[nodiscard]] insert_result _insert_uninitialized_with_hash(size_t const hash, Key const& key)
+	{
+		return insert_uninitialized_with_hash(hash, key);
+	}
+
+	// Erases a slot inserted by _insert_uninitialized_with_hash without destroying its element,
+	// for use when constructing the element failed.
+	void _erase_uninitialized(const_single_iterator const iterator)
+	{
+		T* const slot = const_cast<T*>(std::to_address(iterator));
+		size_t const slot_index = static_cast<size_t>(
+			reinterpret_cast<unsigned char*>(slot) - this->_get_ptr()) / sizeof(T);
+
+		_swiss_table_erase_1(*this, sizeof(T), slot_index);
+	}
+
+	[[nodiscard]] size_t _slot_count() const noexcept
+	{
+		return this->m_capacity;
+	}
+
+	[[nodiscard]] size_t _free_count() const noexcept
+	{
+		return this->m_free;
+	}
+
+	// Returns the storage of the table: the slots followed by the control bytes.
+	[[nodiscard]] std::span<unsigned char const> _storage() const noexcept
+	{
+		size_t const capacity = this->m_capacity;
+
+		// The storage of an empty table with no capacity is the shared empty group.
+		return std::span<unsigned char const>(
+			this->_get_ptr(),
+			capacity != 0
+				? _swiss_table_storage_size(capacity, sizeof(T))
+				: _swiss_table_group_size);
+	}
+
 	void erase(const_single_iterator const iterator)
 	{
-		std::destroy_at(std::to_address(iterator));
-		_swiss_table_erase<T>(*this, std::to_address(iterator));
+		T* const slot = const_cast<T*>(std::to_address(iterator));
+		size_t const slot_index = static_cast<size_t>(
+			reinterpret_cast<unsigned char*>(slot) - this->_get_ptr()) / sizeof(T);
+
+		std::destroy_at(slot);
+		_swiss_table_erase_1(*this, sizeof(T), slot_index);
 	}
 
 
@@ -1442,23 +2395,99 @@ protected:
 
 	template<typename Key>
 	[[nodiscard]] insert_result insert_uninitialized(Key const& key)
+	{
+		return insert_uninitialized_with_hash(_swiss_table_base_impl::hash(key), key);
+	}
+
+	template<typename Key>
+	[[nodiscard]] insert_result insert_uninitialized_with_hash(size_t const hash, Key const& key)
 	{
 		decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, key);
 		decltype(auto) k_canonical = vsm::normalize_key(k);
 		using k_type = remove_ref_t<decltype(k_canonical)>;
 
-		auto const [storage, inserted] = _swiss_table_insert<sizeof(T), Key, k_type>(
+		auto const [storage, inserted] = _swiss_table_insert<sizeof(T), K, k_type>(
 			*this,
-			static_cast<P const&>(this->m_policies)
-				.hasher(static_cast<k_type const&>(k_canonical)),
+			hash,
 			k_canonical,
 			_swiss_table_resize_3<T, K, P, A>);
 
 		return { single_iterator(static_cast<T*>(storage)), inserted };
 	}
 
+	// Inserts a new slot for a key known not to be present in the table. The key is not compared.
+	[[nodiscard]] single_iterator insert_unique_uninitialized_with_hash(size_t const hash)
+	{
+		void* const storage = _swiss_table_insert_1(
+			*this,
+			sizeof(T),
+			hash,
+			_swiss_table_resize_3<T, K, P, A>);
+
+		return single_iterator(static_cast<T*>(storage));
+	}
+
 	template<typename BaseFacade, size_t Capacity>
 	friend class _swiss_table_impl;
+
+private:
+	template<typename Key, typename Iterator>
+	void _find_many(std::span<Key const> const keys, std::span<Iterator> const results) const
+	{
+		vsm_assert(keys.size() == results.size());
+
+		static constexpr size_t distance = _swiss_table_prefetch_distance;
+		static constexpr size_t hashes_size = distance * 4;
+
+		// Hashes of the keys currently in the pipeline.
+		size_t hashes[hashes_size];
+
+		// Hashes of the next keys to enter the pipeline, computed in batches.
+		size_t batch_hashes[hashes_size];
+
+		// Each key passes through three stages, each separated by distance iterations:
+		// 1. The key is hashed and its first probed control group is prefetched.
+		// 2. The first slot matching the hash within that control group is prefetched.
+		// 3. The key is looked up.
+		for (size_t i = 0, size = keys.size(); i < size + distance * 2; ++i)
+		{
+			if (i < size)
+			{
+				if (i % hashes_size == 0)
+				{
+					size_t const batch_size = std::min(hashes_size, size - i);
+					_swiss_table_base_impl::hash_many(
+						keys.subspan(i, batch_size),
+						std::span<size_t>(batch_hashes, batch_size));
+				}
+				size_t const hash = batch_hashes[i % hashes_size];
+
+				hashes[i % hashes_size] = hash;
+				_swiss_table_prefetch_group(*this, sizeof(T), hash);
+			}
+
+			if (i >= distance && i - distance < size)
+			{
+				_swiss_table_prefetch_slot(*this, sizeof(T), hashes[(i - distance) % hashes_size]);
+			}
+
+			if (i >= distance * 2)
+			{
+				size_t const j = i - distance * 2;
+
+				decltype(auto) k = detail::get_lookup_key<K>(this->m_policies.key_selector, keys[j]);
+				decltype(auto) k_canonical = vsm::normalize_key(k);
+				using k_type = remove_ref_t<decltype(k_canonical)>;
+
+				void* const storage = _swiss_table_find<sizeof(T), K, k_type>(
+					*this,
+					hashes[j % hashes_size],
+					k_canonical);
+
+				results[j] = Iterator(static_cast<T*>(storage));
+			}
+		}
+	}
 };
 
 
@@ -1511,6 +2540,25 @@ public:
 		_initialize();
 	}
 
+	template<std::ranges::input_range R>
+		requires requires (base& table, R&& range) { table.insert_range(vsm_forward(range)); }
+	_swiss_table_impl(std::from_range_t, R&& range)
+	{
+		_initialize();
+		this->insert_range(vsm_forward(range));
+	}
+
+	template<std::ranges::input_range R>
+		requires requires (base& table, R&& range)
+		{
+			table.insert_range(unique_keys, vsm_forward(range));
+		}
+	_swiss_table_impl(std::from_range_t, unique_keys_t, R&& range)
+	{
+		_initialize();
+		this->insert_range(unique_keys, vsm_forward(range));
+	}
+
 	_swiss_table_impl(_swiss_table_impl&& other) noexcept
 		requires allocators::is_propagatable_v<A>
 		: base(other.m_policies, other.m_allocator)
@@ -1539,6 +2587,31 @@ public:
 		return *this;
 	}
 
+	_swiss_table_impl(_swiss_table_impl const& other)
+		requires std::is_copy_constructible_v<T>
+		: base(other.m_policies, other.m_allocator)
+	{
+		_initialize();
+		_swiss_table_copy<T>(*this, other);
+	}
+
+	_swiss_table_impl& operator=(_swiss_table_impl const& other) &
+		requires std::is_copy_constructible_v<T>
+	{
+		if (vsm_likely(this != &other))
+		{
+			if (this->m_size != 0)
+			{
+				_swiss_table_clear<T>(*this);
+			}
+
+			this->m_policies = static_cast<P const&>(other.m_policies);
+			_swiss_table_copy<T>(*this, other);
+		}
+
+		return *this;
+	}
+
 	~_swiss_table_impl()
 	{
 		_swiss_table_destroy<T>(*this);
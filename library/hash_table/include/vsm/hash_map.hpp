@@ -7,8 +7,52 @@
 
 #include <memory>
 #include <new>
+#include <ranges>
+#include <tuple>
 
 namespace vsm {
+namespace detail {
+
+// Elements of ranges inserted into hash maps may be key_value_pairs or tuple-like pairs.
+template<typename Element>
+decltype(auto) _hash_map_element_key(Element&& element)
+{
+	if constexpr (requires { element.key; })
+	{
+		return (vsm_forward(element).key);
+	}
+	else
+	{
+		using std::get;
+		return get<0>(vsm_forward(element));
+	}
+}
+
+template<typename Element>
+decltype(auto) _hash_map_element_value(Element&& element)
+{
+	if constexpr (requires { element.value; })
+	{
+		return (vsm_forward(element).value);
+	}
+	else
+	{
+		using std::get;
+		return get<1>(vsm_forward(element));
+	}
+}
+
+template<typename Range, typename Table>
+concept _hash_map_insertable_range =
+	std::ranges::input_range<Range> &&
+	requires (std::ranges::range_reference_t<Range> element)
+	{
+		{ _hash_map_element_key(vsm_forward(element)) } -> hash_table_key<Table>;
+		{ _hash_map_element_value(vsm_forward(element)) }
+			-> std::convertible_to<typename Table::value_type::value_type>;
+	};
+
+} // namespace detail
 
 template<non_cvref HashTableBase>
 class new_basic_hash_map_base : public HashTableBase
@@ -111,6 +155,21 @@ public:
 		return r;
 	}
 
+	template<detail::hash_table_key<HashTableBase> K, std::convertible_to<mapped_type> V>
+	typename HashTableBase::insert_result insert_with_hash(size_t const hash, K&& key, V&& value)
+	{
+		auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+		if (r.inserted)
+		{
+			::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+				vsm_forward(key),
+				vsm_forward(value));
+		}
+
+		return r;
+	}
+
 	template<detail::hash_table_key<HashTableBase> K, typename... Args>
 		requires std::constructible_from<mapped_type, Args...>
 	typename HashTableBase::insert_result try_emplace(K&& key, Args&&... args)
@@ -127,6 +186,25 @@ public:
 		return r;
 	}
 
+	template<detail::hash_table_key<HashTableBase> K, typename... Args>
+		requires std::constructible_from<mapped_type, Args...>
+	typename HashTableBase::insert_result try_emplace_with_hash(
+		size_t const hash,
+		K&& key,
+		Args&&... args)
+	{
+		auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+		if (r.inserted)
+		{
+			::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+				vsm_forward(key),
+				mapped_type(vsm_forward(args)...));
+		}
+
+		return r;
+	}
+
 	template<detail::hash_table_key<HashTableBase> K, std::convertible_to<mapped_type> V>
 	typename HashTableBase::insert_result insert_or_assign(K&& key, V&& value)
 	{
@@ -147,6 +225,84 @@ public:
 	}
 
 
+	template<detail::hash_table_key<HashTableBase> K, std::convertible_to<mapped_type> V>
+	typename HashTableBase::insert_result insert_or_assign_with_hash(
+		size_t const hash,
+		K&& key,
+		V&& value)
+	{
+		auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+		if (r.inserted)
+		{
+			::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+				vsm_forward(key),
+				vsm_forward(value));
+		}
+		else
+		{
+			r.iterator->value = vsm_forward(value);
+		}
+
+		return r;
+	}
+
+
+	// Inserts each element of the range not already present in the map. If the range contains
+	// multiple elements with equal keys, only the first one is inserted.
+	template<detail::_hash_map_insertable_range<HashTableBase> R>
+	void insert_range(R&& range)
+	{
+		reserve_range(range);
+		detail::_hash_table_insert_range(
+			vsm_forward(range),
+			[this](auto const& element)
+			{
+				return HashTableBase::hash(detail::_hash_map_element_key(element));
+			},
+			[this](size_t const hash, auto&& element)
+			{
+				decltype(auto) key = detail::_hash_map_element_key(vsm_forward(element));
+				auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+				if (r.inserted)
+				{
+					::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+						vsm_forward(key),
+						detail::_hash_map_element_value(vsm_forward(element)));
+				}
+			});
+	}
+
+	// Inserts each element of the range without comparing keys.
+	// The keys must not be present in the map and must be unique within the range.
+	template<detail::_hash_map_insertable_range<HashTableBase> R>
+	void insert_range(unique_keys_t, R&& range)
+	{
+		reserve_range(range);
+		detail::_hash_table_insert_range(
+			vsm_forward(range),
+			[this](auto const& element)
+			{
+				return HashTableBase::hash(detail::_hash_map_element_key(element));
+			},
+			[this](size_t const hash, auto&& element)
+			{
+				vsm_assert(
+					HashTableBase::find_with_hash(
+						hash,
+						detail::_hash_map_element_key(vsm_as_const(element))) ==
+					HashTableBase::end());
+
+				auto const it = HashTableBase::insert_unique_uninitialized_with_hash(hash);
+
+				::new (std::to_address(it)) typename HashTableBase::value_type(
+					detail::_hash_map_element_key(vsm_forward(element)),
+					detail::_hash_map_element_value(vsm_forward(element)));
+			});
+	}
+
+
 	[[nodiscard]] auto vsm_always_inline cbegin() const
 	{
 		return HashTableBase::begin();
@@ -156,6 +312,16 @@ public:
 	{
 		return HashTableBase::end();
 	}
+
+private:
+	template<typename R>
+	void reserve_range(R& range)
+	{
+		if constexpr (std::ranges::sized_range<R>)
+		{
+			HashTableBase::reserve(HashTableBase::size() + std::ranges::size(range));
+		}
+	}
 };
 
 } // namespace vsm
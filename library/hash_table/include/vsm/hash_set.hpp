@@ -7,6 +7,8 @@
 
 #include <memory>
 #include <new>
+#include <ranges>
+#include <span>
 
 namespace vsm {
 
@@ -58,6 +60,20 @@ public:
 		return r;
 	}
 
+	template<detail::hash_table_key<HashTableBase> K>
+	typename HashTableBase::insert_result insert_with_hash(size_t const hash, K&& key)
+	{
+		auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+		if (r.inserted)
+		{
+			::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+				vsm_forward(key));
+		}
+
+		return r;
+	}
+
 	template<detail::hash_table_key<HashTableBase> K>
 	typename HashTableBase::insert_result insert_or_assign(K&& key)
 	{
@@ -114,6 +130,56 @@ public:
 	}
 
 
+	// Inserts each element of the range not already present in the set.
+	template<std::ranges::input_range R>
+		requires detail::hash_table_key<std::ranges::range_reference_t<R>, HashTableBase>
+	void insert_range(R&& range)
+	{
+		reserve_range(range);
+		detail::_hash_table_insert_range(
+			vsm_forward(range),
+			[this](auto const& key)
+			{
+				return HashTableBase::hash(key);
+			},
+			[this](size_t const hash, auto&& key)
+			{
+				auto const r = HashTableBase::insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+				if (r.inserted)
+				{
+					::new (std::to_address(r.iterator)) typename HashTableBase::value_type(
+						vsm_forward(key));
+				}
+			},
+			get_hash_many<R>());
+	}
+
+	// Inserts each element of the range without comparing keys.
+	// The keys must not be present in the set and must be unique within the range.
+	template<std::ranges::input_range R>
+		requires detail::hash_table_key<std::ranges::range_reference_t<R>, HashTableBase>
+	void insert_range(unique_keys_t, R&& range)
+	{
+		reserve_range(range);
+		detail::_hash_table_insert_range(
+			vsm_forward(range),
+			[this](auto const& key)
+			{
+				return HashTableBase::hash(key);
+			},
+			[this](size_t const hash, auto&& key)
+			{
+				vsm_assert(HashTableBase::find_with_hash(hash, key) == HashTableBase::end());
+
+				auto const it = HashTableBase::insert_unique_uninitialized_with_hash(hash);
+
+				::new (std::to_address(it)) typename HashTableBase::value_type(vsm_forward(key));
+			},
+			get_hash_many<R>());
+	}
+
+
 	[[nodiscard]] auto vsm_always_inline cbegin() const
 	{
 		return HashTableBase::begin();
@@ -123,6 +189,41 @@ public:
 	{
 		return HashTableBase::end();
 	}
+
+private:
+	template<typename R>
+	auto get_hash_many() const
+	{
+		using key_type = std::ranges::range_value_t<R>;
+
+		if constexpr (
+			requires (
+				HashTableBase const& table,
+				std::span<key_type const> const keys,
+				std::span<size_t> const hashes)
+			{
+				table.hash_many(keys, hashes);
+			})
+		{
+			return [this](std::span<key_type const> const keys, std::span<size_t> const hashes)
+			{
+				HashTableBase::hash_many(keys, hashes);
+			};
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	template<typename R>
+	void reserve_range(R& range)
+	{
+		if constexpr (std::ranges::sized_range<R>)
+		{
+			HashTableBase::reserve(HashTableBase::size() + std::ranges::size(range));
+		}
+	}
 };
 
 } // namespace vsm
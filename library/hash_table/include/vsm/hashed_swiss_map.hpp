@@ -0,0 +1,459 @@
+#pragma once
+
+#include <vsm/concepts.hpp>
+#include <vsm/exceptions.hpp>
+#include <vsm/swiss_set.hpp>
+
+namespace vsm {
+namespace detail {
+
+template<typename T>
+struct _hashed_swiss_map_slot
+{
+	size_t hash;
+	T element;
+};
+
+// The key of a slot together with its cached hash.
+template<typename Key>
+struct _hashed_swiss_map_slot_key
+{
+	size_t hash;
+	Key const& key;
+};
+
+// A lookup key together with its precomputed hash.
+template<typename Key>
+struct _hashed_swiss_map_lookup_key
+{
+	size_t hash;
+	Key const& key;
+};
+
+template<typename KeySelector>
+struct _hashed_swiss_map_key_selector
+{
+	vsm_no_unique_address KeySelector key_selector;
+
+	template<typename T>
+	[[nodiscard]] auto operator()(_hashed_swiss_map_slot<T> const& slot) const
+	{
+		using key_type = typename T::key_type;
+		return _hashed_swiss_map_slot_key<key_type>{ slot.hash, slot.element.key };
+	}
+
+	template<typename Key>
+	[[nodiscard]] _hashed_swiss_map_lookup_key<Key> const& operator()(
+		_hashed_swiss_map_lookup_key<Key> const& key) const
+	{
+		return key;
+	}
+};
+
+// The hashes of both slot keys and lookup keys are known in advance, so rehashing the table does
+// not invoke the user provided hasher.
+template<typename Hasher>
+struct _hashed_swiss_map_hasher
+{
+	vsm_no_unique_address Hasher hasher;
+
+	template<typename Key>
+	[[nodiscard]] size_t operator()(_hashed_swiss_map_slot_key<Key> const& key) const
+	{
+		return key.hash;
+	}
+
+	template<typename Key>
+	[[nodiscard]] size_t operator()(_hashed_swiss_map_lookup_key<Key> const& key) const
+	{
+		return key.hash;
+	}
+};
+
+template<typename KeySelector, typename Comparator>
+struct _hashed_swiss_map_comparator
+{
+	vsm_no_unique_address KeySelector key_selector;
+	vsm_no_unique_address Comparator comparator;
+
+	// Most candidate slots with a matching control byte are rejected by comparing the cached
+	// hashes, without accessing any memory referred to by the key of the slot.
+	template<typename LookupKey, typename SlotKey>
+	[[nodiscard]] bool operator()(
+		_hashed_swiss_map_lookup_key<LookupKey> const& lhs,
+		_hashed_swiss_map_slot_key<SlotKey> const& rhs) const
+	{
+		return lhs.hash == rhs.hash && comparator(
+			lhs.key,
+			vsm::normalize_key(key_selector(rhs.key)));
+	}
+};
+
+template<typename T, typename Iterator>
+class _hashed_swiss_map_iterator
+{
+	Iterator m_iterator;
+
+public:
+	using value_type = T;
+	using difference_type = ptrdiff_t;
+
+	_hashed_swiss_map_iterator() = default;
+
+	explicit _hashed_swiss_map_iterator(Iterator const iterator) noexcept
+		: m_iterator(iterator)
+	{
+	}
+
+	template<cv_convertible_to<T> U, typename OtherIterator>
+		requires std::convertible_to<OtherIterator const&, Iterator>
+	_hashed_swiss_map_iterator(_hashed_swiss_map_iterator<U, OtherIterator> const& iterator) noexcept
+		: m_iterator(iterator._base())
+	{
+	}
+
+	[[nodiscard]] T& operator*() const
+	{
+		return m_iterator->element;
+	}
+
+	[[nodiscard]] T* operator->() const
+	{
+		return &m_iterator->element;
+	}
+
+	_hashed_swiss_map_iterator& operator++() &
+		requires requires (Iterator& it) { ++it; }
+	{
+		++m_iterator;
+		return *this;
+	}
+
+	[[nodiscard]] _hashed_swiss_map_iterator operator++(int) &
+		requires requires (Iterator& it) { ++it; }
+	{
+		auto it = *this;
+		++*this;
+		return it;
+	}
+
+	[[nodiscard]] Iterator const& _base() const noexcept
+	{
+		return m_iterator;
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_hashed_swiss_map_iterator const& lhs,
+		_swiss_table_sentinel) noexcept
+	{
+		return lhs.m_iterator == _swiss_table_sentinel();
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_hashed_swiss_map_iterator const& lhs,
+		_hashed_swiss_map_iterator const& rhs) noexcept
+	{
+		return lhs.m_iterator == rhs.m_iterator;
+	}
+};
+
+} // namespace detail
+
+// A swiss_map which stores the full hash of each key alongside the element. Candidate slots
+// matched by the control byte are rejected by comparing the cached hash before the keys are
+// compared, and resizing the table reuses the cached hashes instead of hashing the keys again.
+//
+// This is beneficial for keys which are expensive to compare or hash, such as long strings stored
+// on the heap, at the cost of one additional word of storage per element.
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+class hashed_swiss_map : public detail::hash_map_lookup_facade<
+	hashed_swiss_map<Key, Value, KeySelector, Allocator, Hasher, Comparator>>
+{
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = key_value_pair<Key, Value>;
+	using allocator_type = Allocator;
+	using policies_type = hash_table_policies<KeySelector, Hasher, Comparator>;
+
+private:
+	using slot_type = detail::_hashed_swiss_map_slot<value_type>;
+
+	using table_type = swiss_set<
+		slot_type,
+		detail::_hashed_swiss_map_key_selector<KeySelector>,
+		Allocator,
+		detail::_hashed_swiss_map_hasher<Hasher>,
+		detail::_hashed_swiss_map_comparator<KeySelector, Comparator>>;
+
+	// Used only for constraining lookup keys.
+	struct key_traits
+	{
+		using key_type = Key;
+		using policies_type = hashed_swiss_map::policies_type;
+	};
+
+	table_type m_table;
+
+public:
+	using iterator = detail::_hashed_swiss_map_iterator<
+		value_type,
+		typename table_type::iterator>;
+
+	using const_iterator = detail::_hashed_swiss_map_iterator<
+		value_type const,
+		typename table_type::const_iterator>;
+
+	using single_iterator = detail::_hashed_swiss_map_iterator<
+		value_type,
+		typename table_type::single_iterator>;
+
+	using const_single_iterator = detail::_hashed_swiss_map_iterator<
+		value_type const,
+		typename table_type::const_single_iterator>;
+
+	using insert_result = vsm::insert_result<single_iterator>;
+
+
+	hashed_swiss_map() = default;
+
+	explicit hashed_swiss_map(policies_type const& policies)
+		: m_table(make_table_policies(policies))
+	{
+	}
+
+	explicit hashed_swiss_map(Allocator const& allocator)
+		: m_table(allocator)
+	{
+	}
+
+	explicit hashed_swiss_map(policies_type const& policies, Allocator const& allocator)
+		: m_table(make_table_policies(policies), allocator)
+	{
+	}
+
+
+	[[nodiscard]] policies_type policies() const
+	{
+		auto const& p = m_table.policies();
+		return policies_type
+		{
+			p.key_selector.key_selector,
+			p.hasher.hasher,
+			p.comparator.comparator,
+		};
+	}
+
+	[[nodiscard]] Allocator const& allocator() const noexcept
+	{
+		return m_table.allocator();
+	}
+
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return m_table.empty();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_table.size();
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return m_table.capacity();
+	}
+
+	void reserve(size_t const min_capacity)
+	{
+		m_table.reserve(min_capacity);
+	}
+
+	void clear()
+	{
+		m_table.clear();
+	}
+
+
+	template<detail::hash_table_key<key_traits> K>
+	[[nodiscard]] size_t hash(K const& key) const
+	{
+		auto const& p = m_table.policies();
+		decltype(auto) k = detail::get_lookup_key<Key>(p.key_selector.key_selector, key);
+		return p.hasher.hasher(vsm::normalize_key(k));
+	}
+
+	template<detail::hash_table_key<key_traits> K>
+	[[nodiscard]] single_iterator find(K const& key)
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	template<detail::hash_table_key<key_traits> K>
+	[[nodiscard]] const_single_iterator find(K const& key) const
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	template<detail::hash_table_key<key_traits> K>
+	[[nodiscard]] single_iterator find_with_hash(size_t const hash, K const& key)
+	{
+		return lookup(hash, key, [&](auto const& lookup_key)
+		{
+			return single_iterator(m_table.find_with_hash(hash, lookup_key));
+		});
+	}
+
+	template<detail::hash_table_key<key_traits> K>
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, K const& key) const
+	{
+		return lookup(hash, key, [&](auto const& lookup_key)
+		{
+			return const_single_iterator(m_table.find_with_hash(hash, lookup_key));
+		});
+	}
+
+
+	template<detail::hash_table_key<key_traits> K, std::convertible_to<Value> V>
+	insert_result insert(K&& key, V&& value)
+	{
+		return insert_with_hash(hash(key), vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<key_traits> K, std::convertible_to<Value> V>
+	insert_result insert_with_hash(size_t const hash, K&& key, V&& value)
+	{
+		return try_emplace_with_hash(hash, vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<key_traits> K, typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace(K&& key, Args&&... args)
+	{
+		return try_emplace_with_hash(hash(key), vsm_forward(key), vsm_forward(args)...);
+	}
+
+	template<detail::hash_table_key<key_traits> K, typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace_with_hash(size_t const hash, K&& key, Args&&... args)
+	{
+		auto const r = lookup(hash, key, [&](auto const& lookup_key)
+		{
+			return m_table._insert_uninitialized_with_hash(hash, lookup_key);
+		});
+
+		if (r.inserted)
+		{
+			vsm_except_try
+			{
+				::new (std::to_address(r.iterator)) slot_type
+				{
+					hash,
+					value_type(vsm_forward(key), Value(vsm_forward(args)...)),
+				};
+			}
+			vsm_except_catch(...)
+			{
+				m_table._erase_uninitialized(r.iterator);
+				vsm_except_rethrow;
+			}
+		}
+
+		return { single_iterator(r.iterator), r.inserted };
+	}
+
+	template<detail::hash_table_key<key_traits> K, std::convertible_to<Value> V>
+	insert_result insert_or_assign(K&& key, V&& value)
+	{
+		return insert_or_assign_with_hash(hash(key), vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<key_traits> K, std::convertible_to<Value> V>
+	insert_result insert_or_assign_with_hash(size_t const hash, K&& key, V&& value)
+	{
+		auto const r = try_emplace_with_hash(hash, vsm_forward(key), vsm_forward(value));
+
+		if (!r.inserted)
+		{
+			r.iterator->value = vsm_forward(value);
+		}
+
+		return r;
+	}
+
+
+	template<detail::hash_table_key<key_traits> K>
+	size_t erase(K const& key)
+	{
+		return erase_with_hash(hash(key), key);
+	}
+
+	template<detail::hash_table_key<key_traits> K>
+	size_t erase_with_hash(size_t const hash, K const& key)
+	{
+		return lookup(hash, key, [&](auto const& lookup_key)
+		{
+			return m_table.erase_with_hash(hash, lookup_key);
+		});
+	}
+
+	void erase(const_single_iterator const iterator)
+	{
+		m_table.erase(iterator._base());
+	}
+
+
+	[[nodiscard]] iterator begin()
+	{
+		return iterator(m_table.begin());
+	}
+
+	[[nodiscard]] const_iterator begin() const
+	{
+		return const_iterator(m_table.begin());
+	}
+
+	[[nodiscard]] detail::_swiss_table_sentinel end() const
+	{
+		return detail::_swiss_table_sentinel();
+	}
+
+private:
+	static typename table_type::policies_type make_table_policies(policies_type const& policies)
+	{
+		return typename table_type::policies_type
+		{
+			{
+				{ policies.key_selector },
+				{ policies.hasher },
+				{ policies.key_selector, policies.comparator },
+			},
+			{},
+		};
+	}
+
+	template<typename K, typename Function>
+	decltype(auto) lookup(size_t const hash, K const& key, Function&& function) const
+	{
+		decltype(auto) k = detail::get_lookup_key<Key>(
+			m_table.policies().key_selector.key_selector,
+			key);
+		decltype(auto) k_canonical = vsm::normalize_key(k);
+		using k_type = remove_ref_t<decltype(k_canonical)>;
+
+		return vsm_forward(function)(detail::_hashed_swiss_map_lookup_key<k_type>
+		{
+			hash,
+			k_canonical,
+		});
+	}
+};
+
+} // namespace vsm
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <vsm/swiss_map.hpp>
+
+#include <utility>
+
+namespace vsm {
+namespace detail {
+
+// Number of slots of the old table migrated by each modifying operation.
+inline constexpr size_t _incremental_swiss_map_migration_step = _swiss_table_group_size * 2;
+
+template<typename T, typename Iterator>
+class _incremental_swiss_map_iterator
+{
+	Iterator m_iterator;
+	Iterator m_next;
+
+public:
+	using value_type = T;
+	using difference_type = ptrdiff_t;
+
+	_incremental_swiss_map_iterator() = default;
+
+	explicit _incremental_swiss_map_iterator(Iterator const iterator, Iterator const next) noexcept
+		: m_iterator(iterator)
+		, m_next(next)
+	{
+		if (m_iterator == _swiss_table_sentinel())
+		{
+			m_iterator = m_next;
+			m_next = _swiss_table_sentinel();
+		}
+	}
+
+	[[nodiscard]] T& operator*() const
+	{
+		return *m_iterator;
+	}
+
+	[[nodiscard]] T* operator->() const
+	{
+		return std::to_address(m_iterator);
+	}
+
+	_incremental_swiss_map_iterator& operator++() &
+	{
+		++m_iterator;
+
+		if (m_iterator == _swiss_table_sentinel())
+		{
+			m_iterator = m_next;
+			m_next = _swiss_table_sentinel();
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]] _incremental_swiss_map_iterator operator++(int) &
+	{
+		auto it = *this;
+		++*this;
+		return it;
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_incremental_swiss_map_iterator const& lhs,
+		_swiss_table_sentinel) noexcept
+	{
+		return lhs.m_iterator == _swiss_table_sentinel();
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_incremental_swiss_map_iterator const& lhs,
+		_incremental_swiss_map_iterator const& rhs) noexcept
+	{
+		return lhs.m_iterator == rhs.m_iterator;
+	}
+};
+
+} // namespace detail
+
+// A swiss_map which spreads the cost of rehashing across subsequent operations. When the table
+// must be resized or refreshed, a new table is allocated and the old table is retained. Elements
+// are then migrated from the old table into the new one a bounded number of slots at a time by
+// each non-const operation, such that no single operation pays for rehashing the whole table.
+//
+// Lookups consult both tables while a migration is ongoing. Non-const lookups, including find,
+// find_ptr, at and at_ptr, also migrate elements, and so invalidate the iterators and references
+// returned by earlier lookups: After auto& a = map.at(k1); auto& b = map.at(k2); the reference a
+// may be dangling. Const lookups do not migrate, so holding references from several lookups
+// requires looking them up through a const reference to the map, such as std::as_const(map).
+// Any non-const operation may invalidate all iterators and references.
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+class incremental_swiss_map : public detail::hash_map_lookup_facade<
+	incremental_swiss_map<Key, Value, KeySelector, Allocator, Hasher, Comparator>>
+{
+	using map_type = swiss_map<Key, Value, KeySelector, Allocator, Hasher, Comparator>;
+
+	// New elements are only ever inserted into m_map.
+	map_type m_map;
+
+	// The table being migrated into m_map, if any.
+	map_type m_old_map;
+
+	// Index of the first slot in m_old_map not yet migrated.
+	size_t m_migrate_index = 0;
+
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = typename map_type::value_type;
+	using insert_result = typename map_type::insert_result;
+	using single_iterator = typename map_type::single_iterator;
+	using const_single_iterator = typename map_type::const_single_iterator;
+
+	using iterator = detail::_incremental_swiss_map_iterator<
+		value_type,
+		typename map_type::iterator>;
+
+	using const_iterator = detail::_incremental_swiss_map_iterator<
+		value_type const,
+		typename map_type::const_iterator>;
+
+
+	incremental_swiss_map() = default;
+
+	incremental_swiss_map(incremental_swiss_map&& other) noexcept
+		: m_map(vsm_move(other.m_map))
+		, m_old_map(vsm_move(other.m_old_map))
+		, m_migrate_index(std::exchange(other.m_migrate_index, 0))
+	{
+	}
+
+	incremental_swiss_map& operator=(incremental_swiss_map&& other) & noexcept
+	{
+		m_map = vsm_move(other.m_map);
+		m_old_map = vsm_move(other.m_old_map);
+		m_migrate_index = std::exchange(other.m_migrate_index, 0);
+		return *this;
+	}
+
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_map.size() + m_old_map.size();
+	}
+
+	// Returns true if elements remain to be migrated from a previous table.
+	[[nodiscard]] bool is_migrating() const noexcept
+	{
+		return m_migrate_index < m_old_map._slot_count();
+	}
+
+	// Reserving capacity completes any ongoing migration.
+	void reserve(size_t const min_capacity)
+	{
+		finish_migration();
+		m_map.reserve(min_capacity);
+	}
+
+	void clear()
+	{
+		m_map.clear();
+		reset_old_map();
+	}
+
+
+	template<detail::hash_table_key<map_type> K>
+	[[nodiscard]] single_iterator find(K const& key)
+	{
+		migrate();
+		return find_with_hash(m_map.hash(key), key);
+	}
+
+	template<detail::hash_table_key<map_type> K>
+	[[nodiscard]] const_single_iterator find(K const& key) const
+	{
+		return find_with_hash(m_map.hash(key), key);
+	}
+
+
+	template<detail::hash_table_key<map_type> K, std::convertible_to<Value> V>
+	insert_result insert(K&& key, V&& value)
+	{
+		size_t const hash = prepare_insert(key);
+
+		if (auto const it = m_old_map.find_with_hash(hash, key); it != m_old_map.end())
+		{
+			return { it, false };
+		}
+
+		return m_map.insert_with_hash(hash, vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<map_type> K, typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace(K&& key, Args&&... args)
+	{
+		size_t const hash = prepare_insert(key);
+
+		if (auto const it = m_old_map.find_with_hash(hash, key); it != m_old_map.end())
+		{
+			return { it, false };
+		}
+
+		return m_map.try_emplace_with_hash(hash, vsm_forward(key), vsm_forward(args)...);
+	}
+
+	template<detail::hash_table_key<map_type> K, std::convertible_to<Value> V>
+	insert_result insert_or_assign(K&& key, V&& value)
+	{
+		size_t const hash = prepare_insert(key);
+
+		if (auto const it = m_old_map.find_with_hash(hash, key); it != m_old_map.end())
+		{
+			it->value = vsm_forward(value);
+			return { it, false };
+		}
+
+		return m_map.insert_or_assign_with_hash(hash, vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<map_type> K>
+	size_t erase(K const& key)
+	{
+		migrate();
+
+		size_t const hash = m_map.hash(key);
+
+		if (size_t const count = m_map.erase_with_hash(hash, key))
+		{
+			return count;
+		}
+
+		return m_old_map.erase_with_hash(hash, key);
+	}
+
+
+	[[nodiscard]] iterator begin()
+	{
+		return iterator(m_map.begin(), m_old_map.begin());
+	}
+
+	[[nodiscard]] const_iterator begin() const
+	{
+		return const_iterator(m_map.begin(), m_old_map.begin());
+	}
+
+	[[nodiscard]] detail::_swiss_table_sentinel end() const
+	{
+		return detail::_swiss_table_sentinel();
+	}
+
+private:
+	template<typename K>
+	[[nodiscard]] single_iterator find_with_hash(size_t const hash, K const& key)
+	{
+		if (auto const it = m_map.find_with_hash(hash, key); it != m_map.end())
+		{
+			return it;
+		}
+		return m_old_map.find_with_hash(hash, key);
+	}
+
+	template<typename K>
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, K const& key) const
+	{
+		if (auto const it = m_map.find_with_hash(hash, key); it != m_map.end())
+		{
+			return it;
+		}
+		return m_old_map.find_with_hash(hash, key);
+	}
+
+	template<typename K>
+	[[nodiscard]] size_t prepare_insert(K const& key)
+	{
+		migrate();
+
+		// When the table would otherwise be resized or refreshed in place by the next insertion,
+		// begin migrating into a new table instead. The initial allocation is left to the table.
+		if (m_map._free_count() == 0 && m_map._slot_count() != 0)
+		{
+			start_migration();
+		}
+
+		return m_map.hash(key);
+	}
+
+	void start_migration()
+	{
+		finish_migration();
+
+		// Mirror the growth policy of the table itself: Grow if more than half of the slots are
+		// occupied. Otherwise the table is only full of tombstones and keeps its capacity.
+		size_t const capacity = m_map.capacity();
+		size_t const new_capacity = m_map.size() > capacity / 2
+			? capacity * 2
+			: capacity;
+
+		m_old_map = vsm_move(m_map);
+		m_migrate_index = 0;
+
+		// This allocates the new table and initializes its control bytes, but no elements are
+		// rehashed until subsequent operations.
+		m_map.reserve(new_capacity);
+	}
+
+	void vsm_always_inline migrate()
+	{
+		if (is_migrating())
+		{
+			migrate(detail::_incremental_swiss_map_migration_step);
+		}
+	}
+
+	void migrate(size_t const slot_count)
+	{
+		m_migrate_index = m_old_map._migrate(m_map, m_migrate_index, slot_count);
+
+		if (!is_migrating())
+		{
+			reset_old_map();
+		}
+	}
+
+	void finish_migration()
+	{
+		if (is_migrating())
+		{
+			migrate(m_old_map._slot_count() - m_migrate_index);
+		}
+	}
+
+	void reset_old_map()
+	{
+		m_old_map = map_type();
+		m_migrate_index = 0;
+	}
+};
+
+} // namespace vsm
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <vsm/offset_ptr.hpp>
+#include <vsm/sanitizer/address.h>
+#include <vsm/standard/stdexcept.hpp>
+#include <vsm/swiss_map.hpp>
+
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include <cstdint>
+#include <cstring>
+
+namespace vsm {
+namespace detail {
+
+// "vsmswiss"
+inline constexpr uint64_t _swiss_table_image_magic = 0x7373697773'6d7376;
+inline constexpr uint32_t _swiss_table_image_version = 1;
+
+// Images and the table storage within them are aligned to a cache line.
+inline constexpr size_t _swiss_table_image_alignment = 64;
+
+struct _swiss_table_image_header
+{
+	uint64_t magic;
+	uint32_t version;
+	uint32_t group_size;
+	uint32_t element_size;
+	uint32_t element_alignment;
+	uint64_t capacity;
+	uint64_t size;
+	uint64_t storage_size;
+
+	// Identifies the hash function used for building the table. See _swiss_table_image_fingerprint.
+	uint64_t hasher_fingerprint;
+
+	// Points to the table storage following the header within the same image.
+	offset_ptr<unsigned char const, int64_t> storage;
+};
+static_assert(sizeof(_swiss_table_image_header) <= _swiss_table_image_alignment);
+
+// Combines the hashes of a few fixed keys. An image is only usable with the hash function which
+// built it, and this detects images built using a different hasher, seed or hash algorithm.
+template<typename Key, typename Policies>
+uint64_t _swiss_table_image_fingerprint(Policies const& policies)
+{
+	uint64_t fingerprint = 0;
+
+	auto const combine = [&](Key const& key)
+	{
+		fingerprint = std::rotl(fingerprint, 17) ^
+			static_cast<uint64_t>(policies.hasher(vsm::normalize_key(key)));
+	};
+
+	if constexpr (std::is_integral_v<Key>)
+	{
+		static constexpr uint64_t probes[] =
+		{
+			0,
+			1,
+			0x0123'4567'89AB'CDEF,
+			0xFEDC'BA98'7654'3210,
+		};
+
+		for (uint64_t const probe : probes)
+		{
+			combine(static_cast<Key>(probe));
+		}
+	}
+	else
+	{
+		combine(Key{});
+	}
+
+	return fingerprint;
+}
+
+inline bool _swiss_table_is_valid_image(
+	std::span<std::byte const> const image,
+	size_t const element_size,
+	size_t const element_alignment,
+	uint64_t const hasher_fingerprint)
+{
+	if (image.size() < sizeof(_swiss_table_image_header) ||
+		reinterpret_cast<uintptr_t>(image.data()) % _swiss_table_image_alignment != 0)
+	{
+		return false;
+	}
+
+	auto const& header = *reinterpret_cast<_swiss_table_image_header const*>(image.data());
+
+	if (header.magic != _swiss_table_image_magic ||
+		header.version != _swiss_table_image_version ||
+		header.group_size != _swiss_table_group_size ||
+		header.element_size != element_size ||
+		header.element_alignment != element_alignment ||
+		header.hasher_fingerprint != hasher_fingerprint)
+	{
+		return false;
+	}
+
+	size_t const capacity = header.capacity;
+
+	if (capacity != 0 &&
+		(!std::has_single_bit(capacity + 1) || capacity < _swiss_table_group_size - 1))
+	{
+		return false;
+	}
+
+	if (header.size > _swiss_table_max_size(capacity))
+	{
+		return false;
+	}
+
+	size_t const storage_size = capacity != 0
+		? _swiss_table_storage_size(capacity, element_size)
+		: _swiss_table_group_size;
+
+	if (header.storage_size != storage_size)
+	{
+		return false;
+	}
+
+	auto const storage = reinterpret_cast<std::byte const*>(header.storage.get());
+	return
+		storage >= image.data() + sizeof(_swiss_table_image_header) &&
+		storage <= image.data() + image.size() &&
+		static_cast<size_t>(image.data() + image.size() - storage) >= storage_size &&
+		reinterpret_cast<uintptr_t>(storage) % element_alignment == 0;
+}
+
+} // namespace detail
+
+// A read-only view of a swiss_map serialized into a position independent image. The image can be
+// written to a file once and later memory mapped by any number of processes, serving lookups
+// directly from the mapped pages without rebuilding the table.
+//
+// The image contains the table storage verbatim, so the element type must be trivially copyable
+// and must not contain pointers. Images can only be read on the same platform, using the same
+// control group size and hasher, as the one used for writing them. Images shared between processes
+// require a hasher which is stable across processes, such as stable_hasher. The image records a
+// fingerprint of the hasher, and images written using a different hasher are rejected.
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Hasher = stable_hasher,
+	typename Comparator = std::equal_to<>>
+class mapped_swiss_map : public detail::hash_map_lookup_facade<
+	mapped_swiss_map<Key, Value, KeySelector, Hasher, Comparator>>
+{
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = key_value_pair<Key, Value>;
+	using policies_type = hash_table_policies<KeySelector, Hasher, Comparator>;
+	using const_iterator = detail::_swiss_table_iterator_n<value_type const>;
+	using const_single_iterator = detail::_swiss_table_iterator_1<value_type const>;
+
+	static_assert(std::is_trivially_copyable_v<value_type>);
+
+	static constexpr size_t image_alignment = detail::_swiss_table_image_alignment;
+
+private:
+	vsm_no_unique_address policies_type m_policies;
+	unsigned char const* m_data = reinterpret_cast<unsigned char const*>(
+		detail::_swiss_table_empty_group.data());
+	size_t m_capacity = 0;
+	size_t m_size = 0;
+
+	template<typename Map>
+	static constexpr bool is_compatible_map =
+		std::is_same_v<typename Map::value_type, value_type> &&
+		std::is_base_of_v<policies_type, typename Map::policies_type>;
+
+public:
+	mapped_swiss_map() = default;
+
+	// The image must remain valid for the lifetime of the view.
+	explicit mapped_swiss_map(std::span<std::byte const> const image)
+		: mapped_swiss_map(image, policies_type())
+	{
+	}
+
+	explicit mapped_swiss_map(std::span<std::byte const> const image, policies_type const& policies)
+		: m_policies(policies)
+	{
+		if (!detail::_swiss_table_is_valid_image(
+			image,
+			sizeof(value_type),
+			alignof(value_type),
+			detail::_swiss_table_image_fingerprint<Key>(m_policies)))
+		{
+			vsm_except_throw_or_terminate(std::invalid_argument("invalid swiss_map image"));
+		}
+
+		auto const& header = *reinterpret_cast<detail::_swiss_table_image_header const*>(
+			image.data());
+
+		m_data = header.storage.get();
+		m_capacity = header.capacity;
+		m_size = header.size;
+	}
+
+
+	// Returns the number of bytes required for the image of the map.
+	template<typename Map>
+		requires is_compatible_map<Map>
+	[[nodiscard]] static size_t image_size(Map const& map) noexcept
+	{
+		return image_alignment + map._storage().size();
+	}
+
+	// Writes the image of the map into the buffer and returns the number of bytes written.
+	// The buffer must be aligned to image_alignment and its size must be at least image_size(map).
+	template<typename Map>
+		requires is_compatible_map<Map>
+	static size_t write_image(Map const& map, std::span<std::byte> const buffer)
+	{
+		std::span<unsigned char const> const storage = map._storage();
+		size_t const capacity = map._slot_count();
+
+		size_t const size = image_alignment + storage.size();
+		vsm_assert(buffer.size() >= size);
+		vsm_assert(reinterpret_cast<uintptr_t>(buffer.data()) % image_alignment == 0);
+
+		std::memset(buffer.data(), 0, image_alignment);
+
+		unsigned char* const image_storage =
+			reinterpret_cast<unsigned char*>(buffer.data() + image_alignment);
+
+		auto* const header = ::new (buffer.data()) detail::_swiss_table_image_header
+		{
+			.magic = detail::_swiss_table_image_magic,
+			.version = detail::_swiss_table_image_version,
+			.group_size = detail::_swiss_table_group_size,
+			.element_size = static_cast<uint32_t>(sizeof(value_type)),
+			.element_alignment = static_cast<uint32_t>(alignof(value_type)),
+			.capacity = capacity,
+			.size = map.size(),
+			.storage_size = storage.size(),
+			.hasher_fingerprint = detail::_swiss_table_image_fingerprint<Key>(
+				static_cast<policies_type const&>(map.policies())),
+			.storage = nullptr,
+		};
+		header->storage = image_storage;
+
+		// Only the full slots are copied. The empty and erased slots are zeroed instead, so that
+		// whatever memory they contain is not written into the image.
+		size_t const slots_size = capacity * sizeof(value_type);
+		std::memset(image_storage, 0, slots_size);
+
+		detail::_swiss_table_ctrl const* const ctrl = detail::_swiss_table_ctrl_ptr(
+			const_cast<unsigned char*>(storage.data()),
+			capacity,
+			sizeof(value_type));
+
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			if (detail::_swiss_table_ctrl_get(ctrl, i) >= static_cast<detail::_swiss_table_ctrl>(0))
+			{
+				std::memcpy(
+					image_storage + i * sizeof(value_type),
+					storage.data() + i * sizeof(value_type),
+					sizeof(value_type));
+			}
+		}
+
+		// The control bytes past the end of the table may be poisoned.
+		vsm_memcpy_no_sanitize_address(
+			image_storage + slots_size,
+			storage.data() + slots_size,
+			storage.size() - slots_size);
+
+		return size;
+	}
+
+
+	[[nodiscard]] policies_type const& policies() const noexcept
+	{
+		return m_policies;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_size;
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return detail::_swiss_table_max_size(m_capacity);
+	}
+
+
+	template<detail::hash_table_key<mapped_swiss_map> K>
+	[[nodiscard]] size_t hash(K const& key) const
+	{
+		decltype(auto) k = detail::get_lookup_key<Key>(m_policies.key_selector, key);
+		return m_policies.hasher(vsm::normalize_key(k));
+	}
+
+	template<detail::hash_table_key<mapped_swiss_map> K>
+	[[nodiscard]] const_single_iterator find(K const& key) const
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	template<detail::hash_table_key<mapped_swiss_map> K>
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, K const& key) const
+	{
+		decltype(auto) k = detail::get_lookup_key<Key>(m_policies.key_selector, key);
+		decltype(auto) k_canonical = vsm::normalize_key(k);
+		using k_type = remove_ref_t<decltype(k_canonical)>;
+
+		void* const storage = detail::_swiss_table_find_2<sizeof(value_type), Key, k_type>(
+			m_policies,
+			const_cast<unsigned char*>(m_data),
+			m_capacity,
+			hash,
+			k_canonical).first;
+
+		return const_single_iterator(static_cast<value_type const*>(storage));
+	}
+
+
+	[[nodiscard]] const_iterator begin() const
+	{
+		return const_iterator(detail::_swiss_table_iterator_n_base::begin<sizeof(value_type)>(
+			const_cast<unsigned char*>(m_data),
+			m_capacity));
+	}
+
+	[[nodiscard]] detail::_swiss_table_sentinel end() const
+	{
+		return detail::_swiss_table_sentinel();
+	}
+};
+
+} // namespace vsm
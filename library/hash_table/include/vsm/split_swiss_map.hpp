@@ -0,0 +1,525 @@
+#pragma once
+
+#include <vsm/allocator.hpp>
+#include <vsm/arrow.hpp>
+#include <vsm/exceptions.hpp>
+#include <vsm/relocate.hpp>
+#include <vsm/swiss_set.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include <cstddef>
+
+namespace vsm {
+namespace detail {
+
+template<typename Key, typename Value, bool ValuesOnly>
+class _split_swiss_map_iterator
+{
+	_swiss_table_iterator_n<Key const> m_key;
+	Key const* m_keys;
+	Value* m_values;
+
+public:
+	using value_type = std::conditional_t<
+		ValuesOnly,
+		Value,
+		key_value_pair<Key, std::remove_const_t<Value>>>;
+
+	using reference = std::conditional_t<
+		ValuesOnly,
+		Value&,
+		key_value_pair<Key const&, Value&>>;
+
+	using difference_type = ptrdiff_t;
+
+	_split_swiss_map_iterator() = default;
+
+	explicit _split_swiss_map_iterator(
+		_swiss_table_iterator_n<Key const> const key,
+		Key const* const keys,
+		Value* const values) noexcept
+		: m_key(key)
+		, m_keys(keys)
+		, m_values(values)
+	{
+	}
+
+	template<typename OtherValue>
+		requires std::is_convertible_v<OtherValue*, Value*>
+	_split_swiss_map_iterator(
+		_split_swiss_map_iterator<Key, OtherValue, ValuesOnly> const& iterator) noexcept
+		: m_key(iterator.m_key)
+		, m_keys(iterator.m_keys)
+		, m_values(iterator.m_values)
+	{
+	}
+
+	[[nodiscard]] Key const& key() const
+	{
+		return *m_key;
+	}
+
+	[[nodiscard]] Value& value() const
+	{
+		// Only the address of the key slot is used, so iterating values does not load the keys.
+		return m_values[std::to_address(m_key) - m_keys];
+	}
+
+	[[nodiscard]] reference operator*() const
+	{
+		if constexpr (ValuesOnly)
+		{
+			return value();
+		}
+		else
+		{
+			return reference{ key(), value() };
+		}
+	}
+
+	[[nodiscard]] auto operator->() const
+	{
+		if constexpr (ValuesOnly)
+		{
+			return &value();
+		}
+		else
+		{
+			return arrow<reference>(**this);
+		}
+	}
+
+	_split_swiss_map_iterator& operator++() &
+	{
+		++m_key;
+		return *this;
+	}
+
+	[[nodiscard]] _split_swiss_map_iterator operator++(int) &
+	{
+		auto it = *this;
+		++m_key;
+		return it;
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_split_swiss_map_iterator const& lhs,
+		_swiss_table_sentinel) noexcept
+	{
+		return lhs.m_key == _swiss_table_sentinel();
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_split_swiss_map_iterator const& lhs,
+		_split_swiss_map_iterator const& rhs) noexcept
+	{
+		return lhs.m_key == rhs.m_key;
+	}
+
+private:
+	template<typename, typename, bool>
+	friend class _split_swiss_map_iterator;
+};
+
+} // namespace detail
+
+// A swiss_map for integral or enumeration keys which stores the keys and the values in two
+// separate arrays. The table itself only contains the keys, which are compared directly without
+// any key selection or normalization. The value of an element is stored at the same index as its
+// key within the array of values.
+//
+// Keys are packed more densely than in a swiss_map of key_value_pair, which benefits lookups, and
+// values can be iterated without loading any of the keys. Because elements are not stored as
+// key_value_pair objects, iterators yield proxy references instead.
+template<
+	typename Key,
+	typename Value,
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher>
+	requires std::integral<Key> || std::is_enum_v<Key>
+class split_swiss_map : public detail::hash_map_lookup_facade<
+	split_swiss_map<Key, Value, Allocator, Hasher>>
+{
+	using key_table_type = swiss_set<Key, identity_key_selector, Allocator, Hasher, std::equal_to<>>;
+
+	static_assert(is_nothrow_relocatable_v<Value>);
+
+	// Allocators are only required to provide fundamental alignment.
+	static_assert(alignof(Value) <= alignof(std::max_align_t));
+
+	key_table_type m_keys;
+	Value* m_values = nullptr;
+
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = key_value_pair<Key, Value>;
+	using reference = key_value_pair<Key const&, Value&>;
+	using const_reference = key_value_pair<Key const&, Value const&>;
+	using allocator_type = Allocator;
+
+	using iterator = detail::_split_swiss_map_iterator<Key, Value, false>;
+	using const_iterator = detail::_split_swiss_map_iterator<Key, Value const, false>;
+	using value_iterator = detail::_split_swiss_map_iterator<Key, Value, true>;
+	using const_value_iterator = detail::_split_swiss_map_iterator<Key, Value const, true>;
+
+	using insert_result = vsm::insert_result<iterator>;
+
+
+	split_swiss_map() = default;
+
+	explicit split_swiss_map(Allocator const& allocator)
+		: m_keys(allocator)
+	{
+	}
+
+	split_swiss_map(split_swiss_map&& other) noexcept
+		: m_keys(vsm_move(other.m_keys))
+		, m_values(std::exchange(other.m_values, nullptr))
+	{
+	}
+
+	split_swiss_map& operator=(split_swiss_map&& other) & noexcept
+	{
+		if (this != &other)
+		{
+			destroy_values();
+			deallocate_values(m_values, m_keys._slot_count());
+
+			m_keys = vsm_move(other.m_keys);
+			m_values = std::exchange(other.m_values, nullptr);
+		}
+		return *this;
+	}
+
+	~split_swiss_map()
+	{
+		destroy_values();
+		deallocate_values(m_values, m_keys._slot_count());
+	}
+
+
+	[[nodiscard]] Allocator const& allocator() const noexcept
+	{
+		return m_keys.allocator();
+	}
+
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return m_keys.empty();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_keys.size();
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return m_keys.capacity();
+	}
+
+	void reserve(size_t const min_capacity)
+	{
+		if (min_capacity > m_keys.capacity())
+		{
+			rebuild(min_capacity);
+		}
+	}
+
+	void clear()
+	{
+		destroy_values();
+		m_keys.clear();
+	}
+
+
+	[[nodiscard]] size_t hash(Key const key) const
+	{
+		return m_keys.hash(key);
+	}
+
+	[[nodiscard]] iterator find(Key const key)
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	[[nodiscard]] const_iterator find(Key const key) const
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	[[nodiscard]] iterator find_with_hash(size_t const hash, Key const key)
+	{
+		return make_found_iterator(m_keys.find_with_hash(hash, key));
+	}
+
+	[[nodiscard]] const_iterator find_with_hash(size_t const hash, Key const key) const
+	{
+		return make_found_iterator(m_keys.find_with_hash(hash, key));
+	}
+
+
+	template<std::convertible_to<Value> V>
+	insert_result insert(Key const key, V&& value)
+	{
+		return try_emplace_with_hash(hash(key), key, vsm_forward(value));
+	}
+
+	template<std::convertible_to<Value> V>
+	insert_result insert_with_hash(size_t const hash, Key const key, V&& value)
+	{
+		return try_emplace_with_hash(hash, key, vsm_forward(value));
+	}
+
+	template<typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace(Key const key, Args&&... args)
+	{
+		return try_emplace_with_hash(hash(key), key, vsm_forward(args)...);
+	}
+
+	template<typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace_with_hash(size_t const hash, Key const key, Args&&... args)
+	{
+		// The key table must never resize itself, as its slots would be moved without their values.
+		if (m_keys._free_count() == 0)
+		{
+			if (auto const it = m_keys.find_with_hash(hash, key); it != m_keys.end())
+			{
+				return { make_found_iterator(it), false };
+			}
+
+			grow();
+		}
+
+		auto const r = m_keys._insert_uninitialized_with_hash(hash, key);
+
+		if (r.inserted)
+		{
+			::new (std::to_address(r.iterator)) Key(key);
+
+			vsm_except_try
+			{
+				::new (&m_values[get_index(std::to_address(r.iterator))]) Value(vsm_forward(args)...);
+			}
+			vsm_except_catch(...)
+			{
+				m_keys.erase(r.iterator);
+				vsm_except_rethrow;
+			}
+		}
+
+		return { make_found_iterator(r.iterator), r.inserted };
+	}
+
+	template<std::convertible_to<Value> V>
+	insert_result insert_or_assign(Key const key, V&& value)
+	{
+		return insert_or_assign_with_hash(hash(key), key, vsm_forward(value));
+	}
+
+	template<std::convertible_to<Value> V>
+	insert_result insert_or_assign_with_hash(size_t const hash, Key const key, V&& value)
+	{
+		auto const r = try_emplace_with_hash(hash, key, vsm_forward(value));
+
+		if (!r.inserted)
+		{
+			r.iterator.value() = vsm_forward(value);
+		}
+
+		return r;
+	}
+
+
+	size_t erase(Key const key)
+	{
+		return erase_with_hash(hash(key), key);
+	}
+
+	size_t erase_with_hash(size_t const hash, Key const key)
+	{
+		auto const it = m_keys.find_with_hash(hash, key);
+
+		if (it == m_keys.end())
+		{
+			return 0;
+		}
+
+		erase_slot(it);
+		return 1;
+	}
+
+	void erase(const_iterator const iterator)
+	{
+		erase_slot(typename key_table_type::const_single_iterator(&iterator.key()));
+	}
+
+
+	[[nodiscard]] iterator begin()
+	{
+		return make_iterator(m_keys.begin());
+	}
+
+	[[nodiscard]] const_iterator begin() const
+	{
+		return make_iterator(m_keys.begin());
+	}
+
+	[[nodiscard]] detail::_swiss_table_sentinel end() const
+	{
+		return detail::_swiss_table_sentinel();
+	}
+
+	[[nodiscard]] std::ranges::subrange<value_iterator, detail::_swiss_table_sentinel> values()
+	{
+		return { value_iterator(m_keys.begin(), get_keys(), m_values), end() };
+	}
+
+	[[nodiscard]] std::ranges::subrange<const_value_iterator, detail::_swiss_table_sentinel> values() const
+	{
+		return { const_value_iterator(m_keys.begin(), get_keys(), m_values), end() };
+	}
+
+private:
+	[[nodiscard]] Key const* get_keys() const noexcept
+	{
+		return reinterpret_cast<Key const*>(m_keys._storage().data());
+	}
+
+	[[nodiscard]] size_t get_index(Key const* const key) const noexcept
+	{
+		return static_cast<size_t>(key - get_keys());
+	}
+
+	[[nodiscard]] iterator make_iterator(detail::_swiss_table_iterator_n<Key const> const it)
+	{
+		return iterator(it, get_keys(), m_values);
+	}
+
+	[[nodiscard]] const_iterator make_iterator(detail::_swiss_table_iterator_n<Key const> const it) const
+	{
+		return const_iterator(it, get_keys(), m_values);
+	}
+
+	[[nodiscard]] iterator make_found_iterator(detail::_swiss_table_iterator_1<Key const> const it)
+	{
+		return iterator(get_iterator_n(it), get_keys(), m_values);
+	}
+
+	[[nodiscard]] const_iterator make_found_iterator(
+		detail::_swiss_table_iterator_1<Key const> const it) const
+	{
+		return const_iterator(get_iterator_n(it), get_keys(), m_values);
+	}
+
+	// Converts an iterator to a single element into an iterator to the rest of the table.
+	[[nodiscard]] detail::_swiss_table_iterator_n<Key const> get_iterator_n(
+		detail::_swiss_table_iterator_1<Key const> const it) const
+	{
+		if (it == m_keys.end())
+		{
+			return detail::_swiss_table_sentinel();
+		}
+
+		Key const* const key = std::to_address(it);
+		unsigned char* const data = const_cast<unsigned char*>(m_keys._storage().data());
+
+		return detail::_swiss_table_iterator_n<Key const>(detail::_swiss_table_iterator_n_base
+		{
+			.m_data = reinterpret_cast<unsigned char*>(const_cast<Key*>(key)),
+			.m_ctrl = detail::_swiss_table_ctrl_ptr(data, m_keys._slot_count(), sizeof(Key)) +
+				get_index(key),
+		});
+	}
+
+	void erase_slot(typename key_table_type::const_single_iterator const it)
+	{
+		std::destroy_at(&m_values[get_index(std::to_address(it))]);
+		m_keys.erase(it);
+	}
+
+	// Mirrors the growth policy of the table itself: Grow if more than half of the slots are
+	// occupied. Otherwise the table is only full of tombstones and keeps its capacity.
+	void grow()
+	{
+		size_t const capacity = m_keys.capacity();
+		size_t const size = m_keys.size();
+
+		rebuild(capacity == 0 || size > capacity / 2 ? std::max<size_t>(capacity * 2, 1) : capacity);
+	}
+
+	// Moves all elements into a new table with at least the specified capacity.
+	void rebuild(size_t const min_capacity)
+	{
+		key_table_type new_keys(m_keys.policies(), m_keys.allocator());
+		new_keys.reserve(std::max(min_capacity, m_keys.size()));
+
+		size_t const new_slot_count = new_keys._slot_count();
+		Value* const new_values = allocate_values(new_slot_count);
+
+		auto const new_keys_data = reinterpret_cast<Key const*>(new_keys._storage().data());
+
+		for (auto it = m_keys.begin(); it != m_keys.end(); ++it)
+		{
+			Key const key = *it;
+			auto const r = new_keys._insert_uninitialized_with_hash(m_keys.hash(key), key);
+			vsm_assert(r.inserted);
+
+			Key* const new_key = std::to_address(r.iterator);
+			::new (new_key) Key(key);
+
+			relocate_at(
+				&m_values[get_index(std::to_address(it))],
+				&new_values[static_cast<size_t>(new_key - new_keys_data)]);
+		}
+
+		deallocate_values(m_values, m_keys._slot_count());
+
+		// The values have been relocated, so only the keys remain to be destroyed.
+		m_keys = vsm_move(new_keys);
+		m_values = new_values;
+	}
+
+	[[nodiscard]] Value* allocate_values(size_t const slot_count)
+	{
+		if (slot_count == 0)
+		{
+			return nullptr;
+		}
+
+		auto const allocation = vsm::allocate_or_throw(
+			m_keys.allocator(),
+			slot_count * sizeof(Value));
+
+		return static_cast<Value*>(allocation.storage);
+	}
+
+	void deallocate_values(Value* const values, size_t const slot_count) noexcept
+	{
+		if (values != nullptr)
+		{
+			m_keys.allocator().deallocate(vsm::allocation(values, slot_count * sizeof(Value)));
+		}
+	}
+
+	void destroy_values() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<Value>)
+		{
+			for (Value& value : values())
+			{
+				std::destroy_at(&value);
+			}
+		}
+	}
+};
+
+} // namespace vsm
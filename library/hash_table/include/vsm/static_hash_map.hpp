@@ -0,0 +1,601 @@
+#pragma once
+
+#include <vsm/allocator.hpp>
+#include <vsm/assert.h>
+#include <vsm/concepts.hpp>
+#include <vsm/constexpr_hash.hpp>
+#include <vsm/default_hash.hpp>
+#include <vsm/hash_map.hpp>
+#include <vsm/int128.hpp>
+#include <vsm/key_value_pair.hpp>
+#include <vsm/relocate.hpp>
+#include <vsm/standard.hpp>
+#include <vsm/standard/stdexcept.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+namespace vsm {
+
+namespace detail {
+
+// Average number of keys per bucket. Each bucket stores one pilot.
+inline constexpr size_t _static_hash_table_bucket_size = 4;
+
+template<typename K, typename Hasher>
+concept _static_hash_table_key = requires (Hasher const& hasher, K const& key)
+{
+	hasher(vsm::normalize_key(key));
+};
+
+inline constexpr size_t _static_hash_table_bucket_count(size_t const size)
+{
+	return std::max<size_t>((size + _static_hash_table_bucket_size - 1) / _static_hash_table_bucket_size, 1);
+}
+
+// Maps the hash onto [0, size) using the high bits of the hash.
+inline constexpr size_t _static_hash_table_reduce(uint64_t const hash, size_t const size)
+{
+	return static_cast<size_t>((static_cast<uint128_t>(hash) * size) >> 64);
+}
+
+inline constexpr uint64_t _static_hash_table_hash(size_t const hash)
+{
+	// The hash is mixed in case the hasher does not distribute its entropy across all bits.
+	return constexpr_hash::mix(static_cast<uint64_t>(hash));
+}
+
+inline constexpr size_t _static_hash_table_bucket(uint64_t const hash, size_t const bucket_count)
+{
+	return _static_hash_table_reduce(hash, bucket_count);
+}
+
+inline constexpr size_t _static_hash_table_position(
+	uint64_t const hash,
+	uint32_t const pilot,
+	size_t const size)
+{
+	return _static_hash_table_reduce(
+		constexpr_hash::mix(hash ^ constexpr_hash::mix(pilot)),
+		size);
+}
+
+// Maximum number of pilot values tried for a single bucket. A bucket of one key must find one of
+// the last free positions, taking on average as many attempts as there are keys, while the minimum
+// is large enough for a few keys sharing a single bucket to find a permutation.
+inline constexpr uint32_t _static_hash_table_max_pilot(size_t const size)
+{
+	return static_cast<uint32_t>(std::min<uint64_t>(
+		std::max<uint64_t>(static_cast<uint64_t>(size) * 64, uint64_t(1) << 20),
+		std::numeric_limits<uint32_t>::max()));
+}
+
+// Builds a minimal perfect hash function over the hashes, in the manner of PTHash: Keys are
+// distributed among buckets, and for each bucket, in order of decreasing size, a pilot value is
+// searched for which maps all keys in the bucket onto distinct free positions.
+// Keys with equal hashes are compared using are_keys_equal(i, j) in order to tell duplicate keys
+// from distinct keys with colliding hashes, neither of which can be mapped onto distinct positions.
+template<typename AreKeysEqual>
+constexpr void _static_hash_table_build(
+	std::span<uint64_t const> const hashes,
+	std::span<uint32_t> const pilots,
+	std::span<size_t> const positions,
+	AreKeysEqual const& are_keys_equal)
+{
+	size_t const size = hashes.size();
+	size_t const bucket_count = pilots.size();
+
+	// Group the keys by bucket.
+	std::vector<size_t> bucket_offsets(bucket_count + 1);
+	for (uint64_t const hash : hashes)
+	{
+		++bucket_offsets[_static_hash_table_bucket(hash, bucket_count) + 1];
+	}
+	for (size_t i = 0; i < bucket_count; ++i)
+	{
+		bucket_offsets[i + 1] += bucket_offsets[i];
+	}
+
+	std::vector<size_t> bucket_keys(size);
+	{
+		std::vector<size_t> bucket_ends(bucket_offsets.begin(), bucket_offsets.end() - 1);
+		for (size_t i = 0; i < size; ++i)
+		{
+			bucket_keys[bucket_ends[_static_hash_table_bucket(hashes[i], bucket_count)]++] = i;
+		}
+	}
+
+	auto const get_bucket_size = [&](size_t const bucket)
+	{
+		return bucket_offsets[bucket + 1] - bucket_offsets[bucket];
+	};
+
+	std::vector<size_t> bucket_order(bucket_count);
+	for (size_t i = 0; i < bucket_count; ++i)
+	{
+		bucket_order[i] = i;
+	}
+	std::ranges::sort(bucket_order, [&](size_t const lhs, size_t const rhs)
+	{
+		size_t const lhs_size = get_bucket_size(lhs);
+		size_t const rhs_size = get_bucket_size(rhs);
+		return lhs_size != rhs_size ? lhs_size > rhs_size : lhs < rhs;
+	});
+
+	std::vector<bool> taken(size);
+	std::vector<size_t> bucket_positions(bucket_count != 0 ? get_bucket_size(bucket_order[0]) : 0);
+
+	for (size_t const bucket : bucket_order)
+	{
+		std::span<size_t const> const keys = std::span(bucket_keys).subspan(
+			bucket_offsets[bucket],
+			get_bucket_size(bucket));
+
+		pilots[bucket] = 0;
+
+		if (keys.empty())
+		{
+			continue;
+		}
+
+		// Keys with equal hashes can never be mapped onto distinct positions.
+		for (size_t i = 0; i < keys.size(); ++i)
+		{
+			for (size_t j = i + 1; j < keys.size(); ++j)
+			{
+				if (hashes[keys[i]] == hashes[keys[j]])
+				{
+					if (are_keys_equal(keys[i], keys[j]))
+					{
+						vsm_except_throw_or_terminate(std::invalid_argument(
+							"duplicate keys in static_hash_map"));
+					}
+
+					vsm_except_throw_or_terminate(std::invalid_argument(
+						"colliding key hashes in static_hash_map"));
+				}
+			}
+		}
+
+		uint32_t const max_pilot = _static_hash_table_max_pilot(size);
+
+		for (uint32_t pilot = 0;; ++pilot)
+		{
+			if (pilot == max_pilot)
+			{
+				vsm_except_throw_or_terminate(std::runtime_error(
+					"static_hash_map pilot search failed"));
+			}
+
+			size_t position_count = 0;
+
+			for (size_t const key : keys)
+			{
+				size_t const position = _static_hash_table_position(hashes[key], pilot, size);
+
+				if (taken[position] ||
+					std::ranges::find(
+						bucket_positions.begin(),
+						bucket_positions.begin() + static_cast<ptrdiff_t>(position_count),
+						position) != bucket_positions.begin() + static_cast<ptrdiff_t>(position_count))
+				{
+					break;
+				}
+
+				bucket_positions[position_count++] = position;
+			}
+
+			if (position_count == keys.size())
+			{
+				for (size_t i = 0; i < keys.size(); ++i)
+				{
+					taken[bucket_positions[i]] = true;
+					positions[keys[i]] = bucket_positions[i];
+				}
+
+				pilots[bucket] = pilot;
+				break;
+			}
+		}
+	}
+}
+
+// Reorders the elements such that each element is placed at the position selected for it by the
+// perfect hash function, and stores the pilots of the function.
+template<typename T, typename Hasher, typename Comparator>
+constexpr void _static_hash_table_initialize(
+	std::span<T> const elements,
+	std::span<uint32_t> const pilots,
+	Hasher const& hasher,
+	Comparator const& comparator)
+{
+	size_t const size = elements.size();
+
+	std::vector<uint64_t> hashes(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		hashes[i] = _static_hash_table_hash(hasher(vsm::normalize_key(elements[i].key)));
+	}
+
+	std::vector<size_t> positions(size);
+	_static_hash_table_build(hashes, pilots, positions, [&](size_t const i, size_t const j)
+	{
+		return comparator(elements[i].key, elements[j].key);
+	});
+
+	// Apply the permutation in place by following its cycles.
+	for (size_t i = 0; i < size; ++i)
+	{
+		while (positions[i] != i)
+		{
+			size_t const j = positions[i];
+
+			using std::swap;
+			swap(elements[i], elements[j]);
+			swap(positions[i], positions[j]);
+		}
+	}
+}
+
+template<typename T, size_t Size, typename Allocator>
+struct _static_hash_table_storage
+{
+	std::array<T, Size> m_elements = {};
+	std::array<uint32_t, _static_hash_table_bucket_count(Size)> m_pilots = {};
+
+	[[nodiscard]] constexpr std::span<T, Size> elements() noexcept
+	{
+		return m_elements;
+	}
+
+	[[nodiscard]] constexpr std::span<T const, Size> elements() const noexcept
+	{
+		return m_elements;
+	}
+
+	[[nodiscard]] constexpr std::span<uint32_t> pilots() noexcept
+	{
+		return m_pilots;
+	}
+
+	[[nodiscard]] constexpr std::span<uint32_t const> pilots() const noexcept
+	{
+		return m_pilots;
+	}
+};
+
+// The elements are stored in a single block allocated using the allocator, followed by the pilots
+// for as many elements as fit in the block. The elements are constructed in place, and m_size only
+// counts the elements constructed so far, such that a partially built table is destroyed correctly
+// if building it throws.
+template<typename T, typename Allocator>
+struct _static_hash_table_storage<T, std::dynamic_extent, Allocator>
+{
+	// Allocators are only required to provide fundamental alignment.
+	static_assert(alignof(T) <= alignof(std::max_align_t));
+
+	unsigned char* m_data = nullptr;
+	size_t m_size = 0;
+	size_t m_capacity = 0;
+	vsm_no_unique_address Allocator m_allocator;
+
+	_static_hash_table_storage() = default;
+
+	explicit _static_hash_table_storage(Allocator const& allocator)
+		: m_allocator(allocator)
+	{
+	}
+
+	_static_hash_table_storage(_static_hash_table_storage&& other) noexcept
+		: m_data(std::exchange(other.m_data, nullptr))
+		, m_size(std::exchange(other.m_size, 0))
+		, m_capacity(std::exchange(other.m_capacity, 0))
+		, m_allocator(other.m_allocator)
+	{
+	}
+
+	_static_hash_table_storage& operator=(_static_hash_table_storage&& other) & noexcept
+	{
+		if (this != &other)
+		{
+			destroy();
+			m_data = std::exchange(other.m_data, nullptr);
+			m_size = std::exchange(other.m_size, 0);
+			m_capacity = std::exchange(other.m_capacity, 0);
+			m_allocator = other.m_allocator;
+		}
+		return *this;
+	}
+
+	~_static_hash_table_storage()
+	{
+		destroy();
+	}
+
+
+	[[nodiscard]] std::span<T> elements() noexcept
+	{
+		return std::span<T>(reinterpret_cast<T*>(m_data), m_size);
+	}
+
+	[[nodiscard]] std::span<T const> elements() const noexcept
+	{
+		return std::span<T const>(reinterpret_cast<T const*>(m_data), m_size);
+	}
+
+	[[nodiscard]] std::span<uint32_t> pilots() noexcept
+	{
+		if (m_data == nullptr)
+		{
+			return {};
+		}
+
+		return std::span<uint32_t>(
+			reinterpret_cast<uint32_t*>(m_data + pilots_offset(m_capacity)),
+			_static_hash_table_bucket_count(m_size));
+	}
+
+	[[nodiscard]] std::span<uint32_t const> pilots() const noexcept
+	{
+		if (m_data == nullptr)
+		{
+			return {};
+		}
+
+		return std::span<uint32_t const>(
+			reinterpret_cast<uint32_t const*>(m_data + pilots_offset(m_capacity)),
+			_static_hash_table_bucket_count(m_size));
+	}
+
+
+	// Moves the elements into a new block with room for new_capacity elements.
+	void reserve(size_t const new_capacity)
+	{
+		vsm_assert(new_capacity > m_capacity);
+
+		if (new_capacity > std::numeric_limits<size_t>::max() / 2 / sizeof(T))
+		{
+			vsm_except_throw_or_terminate(std::length_error("static_hash_map size out of range"));
+		}
+
+		auto const new_allocation = vsm::allocate_or_throw(m_allocator, storage_size(new_capacity));
+		auto const new_data = static_cast<unsigned char*>(new_allocation.storage);
+
+		vsm_except_try
+		{
+			T* const elements = reinterpret_cast<T*>(m_data);
+			uninitialized_relocate(elements, elements + m_size, reinterpret_cast<T*>(new_data));
+		}
+		vsm_except_catch(...)
+		{
+			// A relocation which throws destroys all of the elements.
+			m_size = 0;
+			m_allocator.deallocate(new_allocation);
+			vsm_except_rethrow;
+		}
+
+		deallocate();
+		m_data = new_data;
+		m_capacity = new_capacity;
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args)
+	{
+		vsm_assert(m_size < m_capacity);
+		::new (m_data + m_size * sizeof(T)) T{ vsm_forward(args)... };
+		++m_size;
+	}
+
+private:
+	[[nodiscard]] static size_t pilots_offset(size_t const capacity) noexcept
+	{
+		return (capacity * sizeof(T) + alignof(uint32_t) - 1) & ~(alignof(uint32_t) - 1);
+	}
+
+	[[nodiscard]] static size_t storage_size(size_t const capacity) noexcept
+	{
+		return pilots_offset(capacity) + _static_hash_table_bucket_count(capacity) * sizeof(uint32_t);
+	}
+
+	void deallocate() noexcept
+	{
+		if (m_data != nullptr)
+		{
+			m_allocator.deallocate(vsm::allocation(m_data, storage_size(m_capacity)));
+		}
+	}
+
+	void destroy() noexcept
+	{
+		std::destroy(elements().begin(), elements().end());
+		deallocate();
+	}
+};
+
+} // namespace detail
+
+// An immutable hash map built over a fixed set of keys using a minimal perfect hash function.
+// A lookup computes one hash and compares the key of exactly one element.
+//
+// If Size is std::dynamic_extent, the size of the map is determined at run time, and the elements
+// are stored in memory allocated using the allocator, and the default hasher is default_hasher.
+// The key and value types must then be move constructible and swappable. Otherwise the map is a
+// literal type which can be built in a constant expression, given a hasher usable in constant
+// expressions, such as the default constexpr_hasher. The key and value types must then be default
+// constructible and swappable.
+template<
+	typename Key,
+	typename Value,
+	size_t Size = std::dynamic_extent,
+	typename Hasher = std::conditional_t<
+		Size == std::dynamic_extent,
+		default_hasher,
+		constexpr_hasher>,
+	typename Comparator = std::equal_to<>,
+	typename Allocator = default_allocator>
+class static_hash_map : public detail::hash_map_lookup_facade<
+	static_hash_map<Key, Value, Size, Hasher, Comparator, Allocator>>
+{
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = key_value_pair<Key, Value>;
+	using allocator_type = Allocator;
+	using policies_type = hash_table_policies<default_key_selector, Hasher, Comparator>;
+	using const_iterator = value_type const*;
+
+private:
+	detail::_static_hash_table_storage<value_type, Size, Allocator> m_storage;
+	vsm_no_unique_address policies_type m_policies;
+
+public:
+	constexpr static_hash_map()
+		requires (Size == 0 || Size == std::dynamic_extent)
+	{
+	}
+
+	explicit static_hash_map(Allocator const& allocator)
+		requires (Size == std::dynamic_extent)
+		: m_storage(allocator)
+	{
+	}
+
+	// Builds the map from an array of elements with unique keys.
+	template<size_t N>
+		requires (N == Size)
+	constexpr explicit static_hash_map(value_type const(&elements)[N])
+	{
+		std::ranges::copy(elements, m_storage.m_elements.begin());
+		initialize();
+	}
+
+	// Builds the map from a range of elements with unique keys.
+	template<std::ranges::input_range R>
+		requires (Size == std::dynamic_extent)
+	explicit static_hash_map(
+		std::from_range_t,
+		R&& range,
+		Allocator const& allocator = Allocator())
+		: m_storage(allocator)
+	{
+		if constexpr (std::ranges::sized_range<R>)
+		{
+			if (size_t const size = static_cast<size_t>(std::ranges::size(range)))
+			{
+				m_storage.reserve(size);
+			}
+		}
+
+		for (auto&& range_element : range)
+		{
+			if constexpr (!std::ranges::sized_range<R>)
+			{
+				if (m_storage.m_size == m_storage.m_capacity)
+				{
+					m_storage.reserve(std::max<size_t>(m_storage.m_capacity * 2, 16));
+				}
+			}
+
+			m_storage.emplace_back(
+				detail::_hash_map_element_key(vsm_forward(range_element)),
+				detail::_hash_map_element_value(vsm_forward(range_element)));
+		}
+
+		initialize();
+	}
+
+
+	[[nodiscard]] Allocator const& allocator() const noexcept
+		requires (Size == std::dynamic_extent)
+	{
+		return m_storage.m_allocator;
+	}
+
+
+	[[nodiscard]] constexpr bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	[[nodiscard]] constexpr size_t size() const noexcept
+	{
+		return m_storage.elements().size();
+	}
+
+
+	template<detail::_static_hash_table_key<Hasher> K>
+	[[nodiscard]] constexpr size_t hash(K const& key) const
+	{
+		return m_policies.hasher(vsm::normalize_key(key));
+	}
+
+	template<detail::_static_hash_table_key<Hasher> K>
+	[[nodiscard]] constexpr const_iterator find(K const& key) const
+	{
+		return find_with_hash(hash(key), key);
+	}
+
+	template<typename K>
+	[[nodiscard]] constexpr const_iterator find_with_hash(size_t const hash, K const& key) const
+	{
+		std::span<value_type const> const elements = m_storage.elements();
+		std::span<uint32_t const> const pilots = m_storage.pilots();
+
+		if (elements.empty())
+		{
+			return end();
+		}
+
+		uint64_t const h = detail::_static_hash_table_hash(hash);
+		uint32_t const pilot = pilots[detail::_static_hash_table_bucket(h, pilots.size())];
+		value_type const& element = elements[
+			detail::_static_hash_table_position(h, pilot, elements.size())];
+
+		return m_policies.comparator(vsm::normalize_key(key), element.key) ? &element : end();
+	}
+
+	[[nodiscard]] constexpr const_iterator begin() const noexcept
+	{
+		return m_storage.elements().data();
+	}
+
+	[[nodiscard]] constexpr const_iterator end() const noexcept
+	{
+		return m_storage.elements().data() + size();
+	}
+
+private:
+	constexpr void initialize()
+	{
+		detail::_static_hash_table_initialize(
+			std::span<value_type>(m_storage.elements()),
+			m_storage.pilots(),
+			m_policies.hasher,
+			m_policies.comparator);
+	}
+};
+
+// Creates a static_hash_map from a braced list of elements with unique keys:
+//   constexpr auto map = make_static_hash_map<std::string_view, int>({ { "a", 1 }, { "b", 2 } });
+template<
+	typename Key,
+	typename Value,
+	typename Hasher = constexpr_hasher,
+	typename Comparator = std::equal_to<>,
+	size_t Size>
+[[nodiscard]] constexpr static_hash_map<Key, Value, Size, Hasher, Comparator> make_static_hash_map(
+	key_value_pair<Key, Value> const(&elements)[Size])
+{
+	return static_hash_map<Key, Value, Size, Hasher, Comparator>(elements);
+}
+
+} // namespace vsm
@@ -0,0 +1,552 @@
+#pragma once
+
+#include <vsm/allocator.hpp>
+#include <vsm/assert.h>
+#include <vsm/exceptions.hpp>
+#include <vsm/standard/stdexcept.hpp>
+#include <vsm/swiss_set.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+namespace vsm {
+namespace detail {
+
+// A bump allocator over a list of chunks obtained from Allocator. The chunk size doubles with each
+// new chunk, up to a limit. Allocations are not aligned, and are only released by resetting the
+// position or by destroying the arena.
+template<typename Allocator>
+class _string_intern_arena
+{
+	struct chunk_header
+	{
+		chunk_header* prev;
+		size_t size;
+	};
+
+	static constexpr size_t min_chunk_size = 4096 - sizeof(chunk_header);
+	static constexpr size_t max_chunk_size = (static_cast<size_t>(1) << 20) - sizeof(chunk_header);
+
+	vsm_no_unique_address Allocator m_allocator;
+	chunk_header* m_chunk = nullptr;
+	unsigned char* m_position = nullptr;
+	unsigned char* m_end = nullptr;
+	size_t m_next_chunk_size = min_chunk_size;
+
+public:
+	struct position_type
+	{
+		chunk_header* chunk;
+		unsigned char* position;
+	};
+
+
+	_string_intern_arena() = default;
+
+	explicit _string_intern_arena(Allocator const& allocator) noexcept
+		: m_allocator(allocator)
+	{
+	}
+
+	_string_intern_arena(_string_intern_arena&& other) noexcept
+		: m_allocator(other.m_allocator)
+		, m_chunk(std::exchange(other.m_chunk, nullptr))
+		, m_position(std::exchange(other.m_position, nullptr))
+		, m_end(std::exchange(other.m_end, nullptr))
+		, m_next_chunk_size(std::exchange(other.m_next_chunk_size, min_chunk_size))
+	{
+	}
+
+	_string_intern_arena& operator=(_string_intern_arena&& other) & noexcept
+	{
+		if (this != &other)
+		{
+			deallocate_chunks(nullptr);
+			m_allocator = other.m_allocator;
+			m_chunk = std::exchange(other.m_chunk, nullptr);
+			m_position = std::exchange(other.m_position, nullptr);
+			m_end = std::exchange(other.m_end, nullptr);
+			m_next_chunk_size = std::exchange(other.m_next_chunk_size, min_chunk_size);
+		}
+		return *this;
+	}
+
+	~_string_intern_arena()
+	{
+		deallocate_chunks(nullptr);
+	}
+
+
+	[[nodiscard]] allocation allocate(
+		size_t const min_size,
+		[[maybe_unused]] size_t const max_size) noexcept
+	{
+		if (static_cast<size_t>(m_end - m_position) < min_size)
+		{
+			if (!allocate_chunk(min_size))
+			{
+				return allocation(nullptr);
+			}
+		}
+
+		unsigned char* const storage = m_position;
+		m_position += min_size;
+		return allocation(storage, min_size);
+	}
+
+	void deallocate(allocation) noexcept
+	{
+	}
+
+
+	[[nodiscard]] position_type get_position() const noexcept
+	{
+		return { m_chunk, m_position };
+	}
+
+	void reset_position(position_type const& position) noexcept
+	{
+		deallocate_chunks(position.chunk);
+
+		m_position = position.position;
+		m_end = m_chunk != nullptr
+			? reinterpret_cast<unsigned char*>(m_chunk + 1) + m_chunk->size
+			: nullptr;
+	}
+
+private:
+	[[nodiscard]] bool allocate_chunk(size_t const min_size) noexcept
+	{
+		size_t const size = std::max(m_next_chunk_size, min_size);
+
+		if (size > static_cast<size_t>(-1) - sizeof(chunk_header))
+		{
+			return false;
+		}
+
+		void* const storage = m_allocator.allocate(
+			sizeof(chunk_header) + size,
+			sizeof(chunk_header) + size).storage;
+
+		if (storage == nullptr)
+		{
+			return false;
+		}
+
+		auto const chunk = ::new (storage) chunk_header{ m_chunk, size };
+
+		m_chunk = chunk;
+		m_position = reinterpret_cast<unsigned char*>(chunk + 1);
+		m_end = m_position + size;
+		m_next_chunk_size = std::min(m_next_chunk_size * 2, max_chunk_size);
+
+		return true;
+	}
+
+	void deallocate_chunks(chunk_header* const last) noexcept
+	{
+		while (m_chunk != last)
+		{
+			chunk_header* const prev = m_chunk->prev;
+			m_allocator.deallocate(allocation(m_chunk, sizeof(chunk_header) + m_chunk->size));
+			m_chunk = prev;
+		}
+	}
+};
+
+// Each string is stored in the string resource as a record consisting of its size and id, each
+// 32 bits, followed by the characters of the string. The records are not aligned.
+inline constexpr size_t _string_intern_record_header_size = 2 * sizeof(uint32_t);
+
+[[nodiscard]] inline uint32_t _string_intern_record_size(char const* const record) noexcept
+{
+	uint32_t size;
+	std::memcpy(&size, record, sizeof(uint32_t));
+	return size;
+}
+
+[[nodiscard]] inline uint32_t _string_intern_record_id(char const* const record) noexcept
+{
+	uint32_t id;
+	std::memcpy(&id, record + sizeof(uint32_t), sizeof(uint32_t));
+	return id;
+}
+
+[[nodiscard]] inline std::string_view _string_intern_record_string(
+	char const* const record) noexcept
+{
+	return std::string_view(
+		record + _string_intern_record_header_size,
+		_string_intern_record_size(record));
+}
+
+struct _string_intern_slot
+{
+	char const* record;
+	size_t hash;
+};
+
+struct _string_intern_slot_key
+{
+	char const* record;
+	size_t hash;
+};
+
+struct _string_intern_lookup_key
+{
+	std::string_view string;
+	size_t hash;
+};
+
+struct _string_intern_key_selector
+{
+	[[nodiscard]] _string_intern_slot_key operator()(_string_intern_slot const& slot) const noexcept
+	{
+		return { slot.record, slot.hash };
+	}
+
+	[[nodiscard]] _string_intern_lookup_key const& operator()(
+		_string_intern_lookup_key const& key) const noexcept
+	{
+		return key;
+	}
+};
+
+template<typename Hasher>
+struct _string_intern_hasher
+{
+	vsm_no_unique_address Hasher hasher;
+
+	[[nodiscard]] size_t operator()(_string_intern_slot_key const& key) const noexcept
+	{
+		return key.hash;
+	}
+
+	[[nodiscard]] size_t operator()(_string_intern_lookup_key const& key) const noexcept
+	{
+		return key.hash;
+	}
+};
+
+// The record of a candidate slot is only accessed if the cached hash matches.
+struct _string_intern_comparator
+{
+	[[nodiscard]] bool operator()(
+		_string_intern_lookup_key const& lhs,
+		_string_intern_slot_key const& rhs) const noexcept
+	{
+		return lhs.hash == rhs.hash && lhs.string == _string_intern_record_string(rhs.record);
+	}
+};
+
+} // namespace detail
+
+// Stores a set of unique strings. Each string is assigned a dense 32-bit id in insertion order and
+// its characters are stored exactly once in a monotonic string resource, such that the views
+// returned by the table remain valid until the table is cleared or the string resource is
+// destroyed. A string resource provided by the user must not be shared with other tables.
+//
+// The strings are indexed by a swiss set of slots holding a pointer to the string record and its
+// full hash. Compared to a hash set of std::string, this avoids one allocation per string and the
+// per-allocation overhead of the allocator.
+template<
+	typename Allocator = default_allocator,
+	typename Hasher = default_hasher,
+	typename StringResource = detail::_string_intern_arena<Allocator>>
+	requires monotonic_memory_resource<StringResource>
+class string_intern_table
+{
+	using slot_type = detail::_string_intern_slot;
+	using lookup_key_type = detail::_string_intern_lookup_key;
+
+	using table_type = swiss_set<
+		slot_type,
+		detail::_string_intern_key_selector,
+		Allocator,
+		detail::_string_intern_hasher<Hasher>,
+		detail::_string_intern_comparator>;
+
+	using position_type = typename StringResource::position_type;
+
+	table_type m_table;
+	StringResource m_string_resource;
+	position_type m_initial_position;
+
+	// Maps ids to string records.
+	char const** m_records = nullptr;
+	size_t m_records_capacity = 0;
+
+public:
+	using id_type = uint32_t;
+	using allocator_type = Allocator;
+	using string_resource_type = StringResource;
+
+	static constexpr id_type invalid_id = static_cast<id_type>(-1);
+
+
+	string_intern_table()
+		requires std::is_default_constructible_v<StringResource>
+		: m_initial_position(m_string_resource.get_position())
+	{
+	}
+
+	explicit string_intern_table(Allocator const& allocator)
+		requires std::is_constructible_v<StringResource, Allocator const&>
+		: m_table(allocator)
+		, m_string_resource(allocator)
+		, m_initial_position(m_string_resource.get_position())
+	{
+	}
+
+	explicit string_intern_table(
+		StringResource string_resource,
+		Allocator const& allocator = Allocator())
+		: m_table(allocator)
+		, m_string_resource(vsm_move(string_resource))
+		, m_initial_position(m_string_resource.get_position())
+	{
+	}
+
+	string_intern_table(string_intern_table&& other) noexcept
+		: m_table(vsm_move(other.m_table))
+		, m_string_resource(vsm_move(other.m_string_resource))
+		, m_initial_position(other.m_initial_position)
+		, m_records(std::exchange(other.m_records, nullptr))
+		, m_records_capacity(std::exchange(other.m_records_capacity, 0))
+	{
+		other.m_initial_position = other.m_string_resource.get_position();
+	}
+
+	string_intern_table& operator=(string_intern_table&& other) & noexcept
+	{
+		if (this != &other)
+		{
+			deallocate_records();
+
+			m_table = vsm_move(other.m_table);
+			m_string_resource = vsm_move(other.m_string_resource);
+			m_initial_position = other.m_initial_position;
+			m_records = std::exchange(other.m_records, nullptr);
+			m_records_capacity = std::exchange(other.m_records_capacity, 0);
+
+			other.m_initial_position = other.m_string_resource.get_position();
+		}
+		return *this;
+	}
+
+	~string_intern_table()
+	{
+		deallocate_records();
+	}
+
+
+	[[nodiscard]] Allocator const& allocator() const noexcept
+	{
+		return m_table.allocator();
+	}
+
+	[[nodiscard]] StringResource const& string_resource() const noexcept
+	{
+		return m_string_resource;
+	}
+
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return m_table.empty();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_table.size();
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return m_table.capacity();
+	}
+
+	void reserve(size_t const min_capacity)
+	{
+		m_table.reserve(min_capacity);
+		reserve_records(min_capacity);
+	}
+
+	// Removes all strings, invalidating all views and ids returned by the table. The string
+	// resource is reset to its position at the construction of the table.
+	void clear()
+	{
+		m_table.clear();
+		m_string_resource.reset_position(m_initial_position);
+	}
+
+
+	[[nodiscard]] size_t hash(std::string_view const string) const
+	{
+		return m_table.policies().hasher.hasher(string);
+	}
+
+	[[nodiscard]] id_type find_id(std::string_view const string) const
+	{
+		return find_id_with_hash(hash(string), string);
+	}
+
+	[[nodiscard]] id_type find_id_with_hash(size_t const hash, std::string_view const string) const
+	{
+		char const* const record = find_record(hash, string);
+		return record != nullptr ? detail::_string_intern_record_id(record) : invalid_id;
+	}
+
+	[[nodiscard]] std::optional<std::string_view> find(std::string_view const string) const
+	{
+		return find_with_hash(hash(string), string);
+	}
+
+	[[nodiscard]] std::optional<std::string_view> find_with_hash(
+		size_t const hash,
+		std::string_view const string) const
+	{
+		char const* const record = find_record(hash, string);
+		if (record == nullptr)
+		{
+			return std::nullopt;
+		}
+		return detail::_string_intern_record_string(record);
+	}
+
+	[[nodiscard]] bool contains(std::string_view const string) const
+	{
+		return find_record(hash(string), string) != nullptr;
+	}
+
+
+	// Returns the string with the specified id, which must have been returned by this table.
+	[[nodiscard]] std::string_view get(id_type const id) const
+	{
+		vsm_assert(id < size());
+		return detail::_string_intern_record_string(m_records[id]);
+	}
+
+	[[nodiscard]] std::string_view operator[](id_type const id) const
+	{
+		return get(id);
+	}
+
+
+	// Returns a view of the interned copy of the string, inserting it if not already present.
+	std::string_view intern(std::string_view const string)
+	{
+		return detail::_string_intern_record_string(intern_record(hash(string), string));
+	}
+
+	std::string_view intern_with_hash(size_t const hash, std::string_view const string)
+	{
+		return detail::_string_intern_record_string(intern_record(hash, string));
+	}
+
+	// Returns the id of the string, inserting it if not already present.
+	id_type intern_id(std::string_view const string)
+	{
+		return detail::_string_intern_record_id(intern_record(hash(string), string));
+	}
+
+	id_type intern_id_with_hash(size_t const hash, std::string_view const string)
+	{
+		return detail::_string_intern_record_id(intern_record(hash, string));
+	}
+
+private:
+	[[nodiscard]] char const* find_record(size_t const hash, std::string_view const string) const
+	{
+		auto const it = m_table.find_with_hash(hash, lookup_key_type{ string, hash });
+		return it != m_table.end() ? it->record : nullptr;
+	}
+
+	[[nodiscard]] char const* intern_record(size_t const hash, std::string_view const string)
+	{
+		size_t const id = m_table.size();
+
+		// Make sure nothing can fail after the slot has been inserted.
+		if (id >= invalid_id || string.size() > static_cast<uint32_t>(-1))
+		{
+			vsm_except_throw_or_terminate(std::length_error("string_intern_table too large"));
+		}
+		reserve_records(id + 1);
+
+		auto const r = m_table._insert_uninitialized_with_hash(
+			hash,
+			lookup_key_type{ string, hash });
+
+		if (!r.inserted)
+		{
+			return r.iterator->record;
+		}
+
+		size_t const record_size = detail::_string_intern_record_header_size + string.size();
+		auto const allocation = m_string_resource.allocate(record_size, record_size);
+
+		if (allocation.storage == nullptr)
+		{
+			m_table._erase_uninitialized(r.iterator);
+			vsm_except_throw_or_terminate(std::bad_alloc());
+		}
+
+		auto const record = static_cast<char*>(allocation.storage);
+		uint32_t const record_string_size = static_cast<uint32_t>(string.size());
+		uint32_t const record_id = static_cast<uint32_t>(id);
+		std::memcpy(record, &record_string_size, sizeof(uint32_t));
+		std::memcpy(record + sizeof(uint32_t), &record_id, sizeof(uint32_t));
+		if (!string.empty())
+		{
+			std::memcpy(
+				record + detail::_string_intern_record_header_size,
+				string.data(),
+				string.size());
+		}
+
+		::new (std::to_address(r.iterator)) slot_type{ record, hash };
+		m_records[id] = record;
+
+		return record;
+	}
+
+	void reserve_records(size_t const min_capacity)
+	{
+		if (min_capacity <= m_records_capacity)
+		{
+			return;
+		}
+
+		size_t const new_capacity = std::max(min_capacity, m_records_capacity * 2);
+
+		auto const allocation = vsm::allocate_or_throw(
+			m_table.allocator(),
+			new_capacity * sizeof(char const*));
+
+		auto const new_records = static_cast<char const**>(allocation.storage);
+		if (m_records != nullptr)
+		{
+			std::memcpy(new_records, m_records, m_table.size() * sizeof(char const*));
+		}
+
+		deallocate_records();
+		m_records = new_records;
+		m_records_capacity = new_capacity;
+	}
+
+	void deallocate_records() noexcept
+	{
+		if (m_records != nullptr)
+		{
+			m_table.allocator().deallocate(
+				vsm::allocation(m_records, m_records_capacity * sizeof(char const*)));
+		}
+	}
+};
+
+} // namespace vsm
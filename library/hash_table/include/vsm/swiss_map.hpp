@@ -13,12 +13,13 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using swiss_map_base = new_basic_hash_map_base<
 	detail::_swiss_table_base_impl<
 		key_value_pair<Key, Value>,
 		Key,
-		hash_table_policies<KeySelector, Hasher, Comparator>,
+		swiss_table_policies<KeySelector, Hasher, Comparator, TombstonePolicy>,
 		Allocator>>;
 
 template<
@@ -27,9 +28,10 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using swiss_map = detail::_swiss_table_impl<
-	swiss_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator>,
+	swiss_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator, TombstonePolicy>,
 	/* Capacity: */ 0>;
 
 template<
@@ -39,9 +41,10 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using small_swiss_map = detail::_swiss_table_impl<
-	swiss_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator>,
+	swiss_map_base<Key, Value, KeySelector, Allocator, Hasher, Comparator, TombstonePolicy>,
 	Capacity>;
 
 } // namespace vsm
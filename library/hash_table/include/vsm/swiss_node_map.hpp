@@ -0,0 +1,417 @@
+#pragma once
+
+#include <vsm/allocator.hpp>
+#include <vsm/concepts.hpp>
+#include <vsm/exceptions.hpp>
+#include <vsm/swiss_set.hpp>
+
+#include <utility>
+
+#include <cstddef>
+
+namespace vsm {
+namespace detail {
+
+template<typename T>
+struct _swiss_node_map_slot
+{
+	T* node;
+};
+
+// Selects the key of the node referred to by a slot. Lookup keys are passed through to the user
+// provided key selector.
+template<typename KeySelector>
+struct _swiss_node_map_key_selector
+{
+	vsm_no_unique_address KeySelector key_selector;
+
+	template<typename T>
+	[[nodiscard]] decltype(auto) operator()(_swiss_node_map_slot<T> const& slot) const
+	{
+		return key_selector(slot.node->key);
+	}
+
+	template<typename K>
+		requires std::invocable<KeySelector const&, K const&>
+	[[nodiscard]] decltype(auto) operator()(K const& key) const
+	{
+		return key_selector(key);
+	}
+};
+
+template<typename T, typename Iterator>
+class _swiss_node_map_iterator
+{
+	Iterator m_iterator;
+
+public:
+	using value_type = T;
+	using difference_type = ptrdiff_t;
+
+	_swiss_node_map_iterator() = default;
+
+	explicit _swiss_node_map_iterator(Iterator const iterator) noexcept
+		: m_iterator(iterator)
+	{
+	}
+
+	template<cv_convertible_to<T> U, typename OtherIterator>
+		requires std::convertible_to<OtherIterator const&, Iterator>
+	_swiss_node_map_iterator(_swiss_node_map_iterator<U, OtherIterator> const& iterator) noexcept
+		: m_iterator(iterator._base())
+	{
+	}
+
+	[[nodiscard]] T& operator*() const
+	{
+		return *m_iterator->node;
+	}
+
+	[[nodiscard]] T* operator->() const
+	{
+		return m_iterator->node;
+	}
+
+	_swiss_node_map_iterator& operator++() &
+		requires requires (Iterator& it) { ++it; }
+	{
+		++m_iterator;
+		return *this;
+	}
+
+	[[nodiscard]] _swiss_node_map_iterator operator++(int) &
+		requires requires (Iterator& it) { ++it; }
+	{
+		auto it = *this;
+		++*this;
+		return it;
+	}
+
+	[[nodiscard]] Iterator const& _base() const noexcept
+	{
+		return m_iterator;
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_swiss_node_map_iterator const& lhs,
+		_swiss_table_sentinel) noexcept
+	{
+		return lhs.m_iterator == _swiss_table_sentinel();
+	}
+
+	[[nodiscard]] friend bool operator==(
+		_swiss_node_map_iterator const& lhs,
+		_swiss_node_map_iterator const& rhs) noexcept
+	{
+		return lhs.m_iterator == rhs.m_iterator;
+	}
+};
+
+} // namespace detail
+
+// A swiss_map which allocates each element in a separate node using NodeAllocator, while the slots
+// of the table only hold pointers to the nodes. Resizing the table relocates only the pointers, so
+// references to elements remain stable until the element is erased, and the value type need not be
+// relocatable. NodeAllocator may for example be a basic_allocator referring to a pool resource
+// with blocks the size of value_type.
+//
+// Lookups incur an additional indirection compared to swiss_map, as do rehashes, which must load
+// the key of each element in order to recompute its hash.
+template<
+	typename Key,
+	typename Value,
+	typename KeySelector = default_key_selector,
+	typename Allocator = default_allocator,
+	typename NodeAllocator = Allocator,
+	typename Hasher = default_hasher,
+	typename Comparator = std::equal_to<>>
+class swiss_node_map : public detail::hash_map_lookup_facade<
+	swiss_node_map<Key, Value, KeySelector, Allocator, NodeAllocator, Hasher, Comparator>>
+{
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = key_value_pair<Key, Value>;
+	using allocator_type = Allocator;
+	using node_allocator_type = NodeAllocator;
+
+private:
+	using slot_type = detail::_swiss_node_map_slot<value_type>;
+
+	// Allocators are only required to provide fundamental alignment.
+	static_assert(alignof(value_type) <= alignof(std::max_align_t));
+
+	using table_type = swiss_set<
+		slot_type,
+		detail::_swiss_node_map_key_selector<KeySelector>,
+		Allocator,
+		Hasher,
+		Comparator>;
+
+	table_type m_table;
+	vsm_no_unique_address NodeAllocator m_node_allocator;
+
+public:
+	using iterator = detail::_swiss_node_map_iterator<
+		value_type,
+		typename table_type::iterator>;
+
+	using const_iterator = detail::_swiss_node_map_iterator<
+		value_type const,
+		typename table_type::const_iterator>;
+
+	using single_iterator = detail::_swiss_node_map_iterator<
+		value_type,
+		typename table_type::single_iterator>;
+
+	using const_single_iterator = detail::_swiss_node_map_iterator<
+		value_type const,
+		typename table_type::const_single_iterator>;
+
+	using insert_result = vsm::insert_result<single_iterator>;
+
+
+	swiss_node_map() = default;
+
+	explicit swiss_node_map(NodeAllocator const& node_allocator)
+		: m_node_allocator(node_allocator)
+	{
+	}
+
+	explicit swiss_node_map(Allocator const& allocator, NodeAllocator const& node_allocator)
+		: m_table(allocator)
+		, m_node_allocator(node_allocator)
+	{
+	}
+
+	swiss_node_map(swiss_node_map&& other) noexcept
+		: m_table(vsm_move(other.m_table))
+		, m_node_allocator(other.m_node_allocator)
+	{
+	}
+
+	swiss_node_map& operator=(swiss_node_map&& other) & noexcept
+	{
+		if (this != &other)
+		{
+			delete_nodes();
+			m_table = vsm_move(other.m_table);
+			m_node_allocator = other.m_node_allocator;
+		}
+		return *this;
+	}
+
+	~swiss_node_map()
+	{
+		delete_nodes();
+	}
+
+
+	[[nodiscard]] Allocator const& allocator() const noexcept
+	{
+		return m_table.allocator();
+	}
+
+	[[nodiscard]] NodeAllocator const& node_allocator() const noexcept
+	{
+		return m_node_allocator;
+	}
+
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return m_table.empty();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return m_table.size();
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return m_table.capacity();
+	}
+
+	void reserve(size_t const min_capacity)
+	{
+		m_table.reserve(min_capacity);
+	}
+
+	void clear()
+	{
+		delete_nodes();
+		m_table.clear();
+	}
+
+
+	template<detail::hash_table_key<table_type> K>
+	[[nodiscard]] size_t hash(K const& key) const
+	{
+		return m_table.hash(key);
+	}
+
+	template<detail::hash_table_key<table_type> K>
+	[[nodiscard]] single_iterator find(K const& key)
+	{
+		return single_iterator(m_table.find(key));
+	}
+
+	template<detail::hash_table_key<table_type> K>
+	[[nodiscard]] const_single_iterator find(K const& key) const
+	{
+		return const_single_iterator(m_table.find(key));
+	}
+
+	template<detail::hash_table_key<table_type> K>
+	[[nodiscard]] single_iterator find_with_hash(size_t const hash, K const& key)
+	{
+		return single_iterator(m_table.find_with_hash(hash, key));
+	}
+
+	template<detail::hash_table_key<table_type> K>
+	[[nodiscard]] const_single_iterator find_with_hash(size_t const hash, K const& key) const
+	{
+		return const_single_iterator(m_table.find_with_hash(hash, key));
+	}
+
+
+	template<detail::hash_table_key<table_type> K, std::convertible_to<Value> V>
+	insert_result insert(K&& key, V&& value)
+	{
+		return insert_with_hash(m_table.hash(key), vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<table_type> K, std::convertible_to<Value> V>
+	insert_result insert_with_hash(size_t const hash, K&& key, V&& value)
+	{
+		return try_emplace_with_hash(hash, vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<table_type> K, typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace(K&& key, Args&&... args)
+	{
+		return try_emplace_with_hash(m_table.hash(key), vsm_forward(key), vsm_forward(args)...);
+	}
+
+	template<detail::hash_table_key<table_type> K, typename... Args>
+		requires std::constructible_from<Value, Args...>
+	insert_result try_emplace_with_hash(size_t const hash, K&& key, Args&&... args)
+	{
+		auto const r = m_table._insert_uninitialized_with_hash(hash, vsm_as_const(key));
+
+		if (r.inserted)
+		{
+			vsm_except_try
+			{
+				::new (std::to_address(r.iterator)) slot_type
+				{
+					new_node(vsm_forward(key), vsm_forward(args)...),
+				};
+			}
+			vsm_except_catch(...)
+			{
+				m_table._erase_uninitialized(r.iterator);
+				vsm_except_rethrow;
+			}
+		}
+
+		return { single_iterator(r.iterator), r.inserted };
+	}
+
+	template<detail::hash_table_key<table_type> K, std::convertible_to<Value> V>
+	insert_result insert_or_assign(K&& key, V&& value)
+	{
+		return insert_or_assign_with_hash(m_table.hash(key), vsm_forward(key), vsm_forward(value));
+	}
+
+	template<detail::hash_table_key<table_type> K, std::convertible_to<Value> V>
+	insert_result insert_or_assign_with_hash(size_t const hash, K&& key, V&& value)
+	{
+		auto const r = try_emplace_with_hash(hash, vsm_forward(key), vsm_forward(value));
+
+		if (!r.inserted)
+		{
+			r.iterator->value = vsm_forward(value);
+		}
+
+		return r;
+	}
+
+
+	template<detail::hash_table_key<table_type> K>
+	size_t erase(K const& key)
+	{
+		return erase_with_hash(m_table.hash(key), key);
+	}
+
+	template<detail::hash_table_key<table_type> K>
+	size_t erase_with_hash(size_t const hash, K const& key)
+	{
+		auto const it = m_table.find_with_hash(hash, key);
+
+		if (it == m_table.end())
+		{
+			return 0;
+		}
+
+		erase(const_single_iterator(it));
+		return 1;
+	}
+
+	void erase(const_single_iterator const iterator)
+	{
+		value_type* const node = iterator._base()->node;
+		m_table.erase(iterator._base());
+		delete_via(node, m_node_allocator);
+	}
+
+
+	[[nodiscard]] iterator begin()
+	{
+		return iterator(m_table.begin());
+	}
+
+	[[nodiscard]] const_iterator begin() const
+	{
+		return const_iterator(m_table.begin());
+	}
+
+	[[nodiscard]] detail::_swiss_table_sentinel end() const
+	{
+		return detail::_swiss_table_sentinel();
+	}
+
+private:
+	template<typename K, typename... Args>
+	[[nodiscard]] value_type* new_node(K&& key, Args&&... args)
+	{
+		auto const allocation = vsm::allocate_or_throw(
+			m_node_allocator,
+			sizeof(value_type),
+			sizeof(value_type));
+
+		vsm_except_try
+		{
+			return ::new (allocation.storage) value_type(
+				vsm_forward(key),
+				Value(vsm_forward(args)...));
+		}
+		vsm_except_catch(...)
+		{
+			m_node_allocator.deallocate(allocation);
+			vsm_except_rethrow;
+		}
+	}
+
+	void delete_nodes()
+	{
+		for (slot_type const& slot : m_table)
+		{
+			delete_via(slot.node, m_node_allocator);
+		}
+	}
+};
+
+} // namespace vsm
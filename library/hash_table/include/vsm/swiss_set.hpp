@@ -12,12 +12,13 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using swiss_set_base = new_basic_hash_set_base<
 	detail::_swiss_table_base_impl<
 		T,
 		T,
-		hash_table_policies<KeySelector, Hasher, Comparator>,
+		swiss_table_policies<KeySelector, Hasher, Comparator, TombstonePolicy>,
 		Allocator>>;
 
 template<
@@ -25,9 +26,10 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using swiss_set = detail::_swiss_table_impl<
-	swiss_set_base<T, KeySelector, Allocator, Hasher, Comparator>,
+	swiss_set_base<T, KeySelector, Allocator, Hasher, Comparator, TombstonePolicy>,
 	/* Capacity: */ 0>;
 
 template<
@@ -36,9 +38,10 @@ template<
 	typename KeySelector = default_key_selector,
 	typename Allocator = default_allocator,
 	typename Hasher = default_hasher,
-	typename Comparator = std::equal_to<>>
+	typename Comparator = std::equal_to<>,
+	typename TombstonePolicy = no_tombstone_rehash>
 using small_swiss_set = detail::_swiss_table_impl<
-	swiss_set_base<T, KeySelector, Allocator, Hasher, Comparator>,
+	swiss_set_base<T, KeySelector, Allocator, Hasher, Comparator, TombstonePolicy>,
 	Capacity>;
 
 } // namespace vsm
@@ -0,0 +1,693 @@
+#include <vsm/array_map.hpp>
+#include <vsm/dense_map.hpp>
+#include <vsm/hashed_swiss_map.hpp>
+#include <vsm/incremental_swiss_map.hpp>
+#include <vsm/split_swiss_map.hpp>
+#include <vsm/swiss_map.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+using value_type = uint64_t;
+
+// Sizes ranging from L1 resident tables to tables far larger than the last level cache.
+static constexpr size_t table_sizes[] =
+{
+	size_t(1) << 8,
+	size_t(1) << 12,
+	size_t(1) << 16,
+	size_t(1) << 20,
+	size_t(1) << 24,
+	100'000'000,
+};
+
+
+// Bijective integer mixers. Mapping distinct indices through these produces distinct keys in an
+// order that is unrelated to the insertion order.
+
+static uint32_t mix_32(uint32_t x)
+{
+	x ^= x >> 16;
+	x *= 0x7FEB352Du;
+	x ^= x >> 15;
+	x *= 0x846CA68Bu;
+	x ^= x >> 16;
+	return x;
+}
+
+static uint64_t mix_64(uint64_t x)
+{
+	x ^= x >> 30;
+	x *= 0xBF58476D1CE4E5B9u;
+	x ^= x >> 27;
+	x *= 0x94D049BB133111EBu;
+	x ^= x >> 31;
+	return x;
+}
+
+static uint64_t mix_48(uint64_t x)
+{
+	static constexpr uint64_t mask = (uint64_t(1) << 48) - 1;
+
+	x = x * 0x9E3779B97F4Bu & mask;
+	x ^= x >> 24;
+	x = x * 0xC2B2AE3D27D5u & mask;
+	x ^= x >> 24;
+	return x;
+}
+
+static void append_hex(std::string& string, uint64_t const value, size_t const digits)
+{
+	static constexpr char hex_digits[] = "0123456789abcdef";
+
+	for (size_t i = digits; i-- > 0;)
+	{
+		string.push_back(hex_digits[value >> i * 4 & 0xF]);
+	}
+}
+
+
+struct u32_keys
+{
+	using type = uint32_t;
+	static constexpr char const* name = "u32";
+	static constexpr size_t max_size = static_cast<size_t>(-1);
+
+	static type make(size_t const index)
+	{
+		return mix_32(static_cast<uint32_t>(index));
+	}
+};
+
+struct u64_keys
+{
+	using type = uint64_t;
+	static constexpr char const* name = "u64";
+	static constexpr size_t max_size = static_cast<size_t>(-1);
+
+	static type make(size_t const index)
+	{
+		return mix_64(index);
+	}
+};
+
+// Short strings fit within the small string buffer of all major standard library implementations.
+struct short_string_keys
+{
+	using type = std::string;
+	static constexpr char const* name = "short_string";
+	static constexpr size_t max_size = size_t(1) << 24;
+
+	static type make(size_t const index)
+	{
+		std::string string;
+		append_hex(string, mix_48(index), 12);
+		return string;
+	}
+};
+
+// Long strings always require a separate heap allocation.
+struct long_string_keys
+{
+	using type = std::string;
+	static constexpr char const* name = "long_string";
+	static constexpr size_t max_size = size_t(1) << 24;
+
+	static type make(size_t const index)
+	{
+		std::string string = "https://example.com/resources/";
+		append_hex(string, mix_48(index), 12);
+		return string;
+	}
+};
+
+
+template<typename Key>
+struct swiss_map_type
+{
+	using type = swiss_map<Key, value_type>;
+	static constexpr char const* name = "swiss_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+template<typename Key>
+struct incremental_swiss_map_type
+{
+	using type = incremental_swiss_map<Key, value_type>;
+	static constexpr char const* name = "incremental_swiss_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+template<typename Key>
+struct hashed_swiss_map_type
+{
+	using type = hashed_swiss_map<Key, value_type>;
+	static constexpr char const* name = "hashed_swiss_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+template<typename Key>
+struct split_swiss_map_type
+{
+	using type = split_swiss_map<Key, value_type>;
+	static constexpr char const* name = "split_swiss_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+template<typename Key>
+struct array_map_type
+{
+	using type = array_map<Key, value_type>;
+	static constexpr char const* name = "array_map";
+
+	// Array table erasure is linear in the capacity of the table.
+	static constexpr size_t max_erase_size = size_t(1) << 16;
+};
+
+template<typename Key>
+struct dense_map_type
+{
+	using type = dense_map<Key, value_type>;
+	static constexpr char const* name = "dense_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+template<typename Key>
+struct std_map_type
+{
+	using type = std::unordered_map<Key, value_type>;
+	static constexpr char const* name = "std::unordered_map";
+	static constexpr size_t max_erase_size = static_cast<size_t>(-1);
+};
+
+
+template<typename Map>
+bool map_insert(Map& map, auto const& key, value_type const value)
+{
+	auto const r = map.try_emplace(key, value);
+
+	if constexpr (requires { r.inserted; })
+	{
+		return r.inserted;
+	}
+	else
+	{
+		return r.second;
+	}
+}
+
+template<typename Map>
+value_type const* map_find(Map const& map, auto const& key)
+{
+	if constexpr (requires { map.at_ptr(key); })
+	{
+		return map.at_ptr(key);
+	}
+	else
+	{
+		auto const it = map.find(key);
+		return it != map.end() ? &it->second : nullptr;
+	}
+}
+
+template<typename Element>
+value_type get_value(Element const& element)
+{
+	if constexpr (requires { element.value; })
+	{
+		return element.value;
+	}
+	else
+	{
+		return element.second;
+	}
+}
+
+
+template<typename Keys>
+std::vector<typename Keys::type> make_keys(size_t const offset, size_t const count, bool const shuffle)
+{
+	std::vector<typename Keys::type> keys;
+	keys.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		keys.push_back(Keys::make(offset + i));
+	}
+
+	if (shuffle)
+	{
+		std::ranges::shuffle(keys, std::mt19937_64(count));
+	}
+
+	return keys;
+}
+
+template<typename Map, typename Keys>
+void fill_map(Map& map, std::vector<typename Keys::type> const& keys)
+{
+	map.reserve(keys.size());
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		map_insert(map, keys[i], static_cast<value_type>(i));
+	}
+}
+
+// Building the largest tables takes a long time, and Google Benchmark may invoke the same
+// benchmark function several times. The lookup benchmarks share one prebuilt table per type.
+template<typename Map, typename Keys>
+struct lookup_fixture
+{
+	size_t size = 0;
+	std::unique_ptr<Map> map;
+	std::vector<typename Keys::type> hit_keys;
+	std::vector<typename Keys::type> miss_keys;
+
+	static lookup_fixture& get(size_t const size)
+	{
+		static lookup_fixture fixture;
+
+		if (fixture.size != size)
+		{
+			fixture = {};
+
+			auto const keys = make_keys<Keys>(0, size, /* shuffle: */ false);
+
+			fixture.size = size;
+			fixture.map = std::make_unique<Map>();
+			fill_map<Map, Keys>(*fixture.map, keys);
+
+			fixture.hit_keys = make_keys<Keys>(0, size, /* shuffle: */ true);
+			fixture.miss_keys = make_keys<Keys>(size, size, /* shuffle: */ true);
+		}
+
+		return fixture;
+	}
+};
+
+
+template<typename Map, typename Keys>
+void benchmark_insert(benchmark::State& state)
+{
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const keys = make_keys<Keys>(0, size, /* shuffle: */ true);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		map->reserve(size);
+		state.ResumeTiming();
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			map_insert(*map, keys[i], static_cast<value_type>(i));
+		}
+		benchmark::DoNotOptimize(map->size());
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// Measures the latency of the slowest single insertion while growing a table without reserving.
+template<typename Map, typename Keys>
+void benchmark_insert_max_latency(benchmark::State& state)
+{
+	using clock = std::chrono::steady_clock;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const keys = make_keys<Keys>(0, size, /* shuffle: */ true);
+
+	clock::duration max_latency = {};
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		state.ResumeTiming();
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto const beg = clock::now();
+			map_insert(*map, keys[i], static_cast<value_type>(i));
+			max_latency = std::max(max_latency, clock::now() - beg);
+		}
+		benchmark::DoNotOptimize(map->size());
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.counters["max_latency_ns"] = static_cast<double>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(max_latency).count());
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// Builds a table from a range of unique elements, as when populating a table during startup.
+template<typename Map, typename Keys>
+void benchmark_build(benchmark::State& state)
+{
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const keys = make_keys<Keys>(0, size, /* shuffle: */ true);
+
+	std::vector<std::pair<typename Keys::type, value_type>> elements;
+	elements.reserve(size);
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		elements.emplace_back(keys[i], static_cast<value_type>(i));
+	}
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		state.ResumeTiming();
+
+		if constexpr (requires { map->insert_range(vsm::unique_keys, elements); })
+		{
+			map->insert_range(vsm::unique_keys, elements);
+		}
+		else
+		{
+			map->reserve(size);
+			for (auto const& [key, value] : elements)
+			{
+				map_insert(*map, key, value);
+			}
+		}
+		benchmark::DoNotOptimize(map->size());
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename Map, typename Keys>
+void benchmark_find_hit(benchmark::State& state)
+{
+	auto const& fixture = lookup_fixture<Map, Keys>::get(static_cast<size_t>(state.range(0)));
+	auto const& map = *fixture.map;
+	auto const& keys = fixture.hit_keys;
+
+	size_t index = 0;
+	for (auto _ : state)
+	{
+		value_type const* const value = map_find(map, keys[index]);
+		benchmark::DoNotOptimize(*value);
+
+		if (++index == keys.size())
+		{
+			index = 0;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Map, typename Keys>
+void benchmark_find_miss(benchmark::State& state)
+{
+	auto const& fixture = lookup_fixture<Map, Keys>::get(static_cast<size_t>(state.range(0)));
+	auto const& map = *fixture.map;
+	auto const& keys = fixture.miss_keys;
+
+	size_t index = 0;
+	for (auto _ : state)
+	{
+		value_type const* const value = map_find(map, keys[index]);
+		benchmark::DoNotOptimize(value);
+
+		if (++index == keys.size())
+		{
+			index = 0;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+// Resolves the keys in batches, as a request handler would.
+template<typename Map, typename Keys>
+void benchmark_find_many(benchmark::State& state)
+{
+	static constexpr size_t batch_size = 256;
+
+	auto const& fixture = lookup_fixture<Map, Keys>::get(static_cast<size_t>(state.range(0)));
+	auto const& map = *fixture.map;
+	auto const& keys = fixture.hit_keys;
+
+	std::vector<typename Map::const_single_iterator> results(batch_size);
+
+	size_t index = 0;
+	for (auto _ : state)
+	{
+		size_t const count = std::min(batch_size, keys.size() - index);
+
+		map.find_many(
+			std::span(keys.data() + index, count),
+			std::span(results.data(), count));
+		benchmark::DoNotOptimize(results.data());
+
+		if ((index += count) == keys.size())
+		{
+			index = 0;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+
+template<typename Map, typename Keys>
+void benchmark_erase(benchmark::State& state)
+{
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const insert_keys = make_keys<Keys>(0, size, /* shuffle: */ false);
+	auto const erase_keys = make_keys<Keys>(0, size, /* shuffle: */ true);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		fill_map<Map, Keys>(*map, insert_keys);
+		state.ResumeTiming();
+
+		for (auto const& key : erase_keys)
+		{
+			benchmark::DoNotOptimize(map->erase(key));
+		}
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename Map, typename Keys>
+void benchmark_iterate(benchmark::State& state)
+{
+	auto const& fixture = lookup_fixture<Map, Keys>::get(static_cast<size_t>(state.range(0)));
+	auto const& map = *fixture.map;
+
+	for (auto _ : state)
+	{
+		value_type sum = 0;
+		for (auto const& element : map)
+		{
+			sum += get_value(element);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(map.size()));
+}
+
+// Measures growing a full table to twice its capacity.
+template<typename Map, typename Keys>
+void benchmark_rehash(benchmark::State& state)
+{
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const keys = make_keys<Keys>(0, size, /* shuffle: */ false);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		fill_map<Map, Keys>(*map, keys);
+		state.ResumeTiming();
+
+		map->reserve(size * 2);
+		benchmark::DoNotOptimize(map->size());
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// Runs the tasks of a parallel rehash on one thread per hardware thread.
+struct thread_executor
+{
+	void operator()(size_t const task_count, auto const& task) const
+	{
+		std::atomic<size_t> next_task_index = 0;
+		auto const run_tasks = [&]()
+		{
+			for (size_t i; (i = next_task_index++) < task_count;)
+			{
+				task(i);
+			}
+		};
+
+		size_t const thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < thread_count; ++i)
+		{
+			threads.emplace_back(run_tasks);
+		}
+		run_tasks();
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+};
+
+// Like benchmark_rehash, but rehashes the elements in parallel using thread_executor.
+template<typename Map, typename Keys>
+void benchmark_parallel_rehash(benchmark::State& state)
+{
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const keys = make_keys<Keys>(0, size, /* shuffle: */ false);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto map = std::make_unique<Map>();
+		fill_map<Map, Keys>(*map, keys);
+		state.ResumeTiming();
+
+		map->reserve(size * 2, thread_executor());
+		benchmark::DoNotOptimize(map->size());
+
+		state.PauseTiming();
+		map.reset();
+		state.ResumeTiming();
+	}
+
+	state.counters["threads"] = static_cast<double>(std::thread::hardware_concurrency());
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+
+template<template<typename> typename MapType, typename Keys>
+void register_benchmarks()
+{
+	using map_type = typename MapType<typename Keys::type>::type;
+
+	auto const register_benchmark = [](
+		char const* const workload,
+		void(*const function)(benchmark::State&),
+		size_t const max_size)
+	{
+		std::string name = MapType<typename Keys::type>::name;
+		name += '<';
+		name += Keys::name;
+		name += ">/";
+		name += workload;
+
+		auto* const b = benchmark::RegisterBenchmark(name.c_str(), function);
+
+		for (size_t const size : table_sizes)
+		{
+			if (size <= std::min(max_size, Keys::max_size))
+			{
+				b->Arg(static_cast<int64_t>(size));
+			}
+		}
+	};
+
+	size_t const max_size = static_cast<size_t>(-1);
+	size_t const max_erase_size = MapType<typename Keys::type>::max_erase_size;
+
+	register_benchmark("insert", benchmark_insert<map_type, Keys>, max_size);
+	register_benchmark("insert_max_latency", benchmark_insert_max_latency<map_type, Keys>, max_size);
+	register_benchmark("build", benchmark_build<map_type, Keys>, max_size);
+	register_benchmark("find_hit", benchmark_find_hit<map_type, Keys>, max_size);
+	register_benchmark("find_miss", benchmark_find_miss<map_type, Keys>, max_size);
+
+	if constexpr (requires (
+		map_type const& map,
+		std::span<typename Keys::type const> const keys,
+		std::span<typename map_type::const_single_iterator> const results)
+	{
+		map.find_many(keys, results);
+	})
+	{
+		register_benchmark("find_many", benchmark_find_many<map_type, Keys>, max_size);
+	}
+
+	register_benchmark("erase", benchmark_erase<map_type, Keys>, max_erase_size);
+	register_benchmark("iterate", benchmark_iterate<map_type, Keys>, max_size);
+	register_benchmark("rehash", benchmark_rehash<map_type, Keys>, max_size);
+
+	if constexpr (requires (map_type& map) { map.reserve(size_t(0), thread_executor()); })
+	{
+		register_benchmark("parallel_rehash", benchmark_parallel_rehash<map_type, Keys>, max_size);
+	}
+}
+
+template<template<typename> typename MapType>
+void register_benchmarks()
+{
+	register_benchmarks<MapType, u32_keys>();
+	register_benchmarks<MapType, u64_keys>();
+	register_benchmarks<MapType, short_string_keys>();
+	register_benchmarks<MapType, long_string_keys>();
+}
+
+[[maybe_unused]] static bool const registered = []()
+{
+	register_benchmarks<swiss_map_type>();
+	register_benchmarks<incremental_swiss_map_type>();
+	register_benchmarks<hashed_swiss_map_type>();
+	register_benchmarks<split_swiss_map_type, u32_keys>();
+	register_benchmarks<split_swiss_map_type, u64_keys>();
+	register_benchmarks<array_map_type>();
+	register_benchmarks<dense_map_type>();
+	register_benchmarks<std_map_type>();
+	return true;
+}();
+
+} // namespace
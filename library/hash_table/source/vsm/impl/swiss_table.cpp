@@ -21,6 +21,45 @@ void _swiss_table_group_x86::convert_special_to_empty_and_full_to_tomb(
 
 #endif
 
+#if vsm_arch_x86_avx2
+
+vsm_no_sanitize_address
+void _swiss_table_group_avx2::convert_special_to_empty_and_full_to_tomb(
+	_swiss_table_ctrl* const group)
+{
+	__m256i const ctrl = _swiss_table_group_avx2::load(group);
+
+	__m256i const msb1 = _mm256_set1_epi8(static_cast<char>(static_cast<uint8_t>(0x80)));
+	__m256i const lsb0 = _mm256_set1_epi8(static_cast<char>(static_cast<uint8_t>(0x7E)));
+
+	// The shuffle operates within each 128-bit lane, but lsb0 is uniform across both lanes.
+	__m256i const result = _mm256_or_si256(_mm256_shuffle_epi8(lsb0, ctrl), msb1);
+
+	_swiss_table_group_avx2::store(group, result);
+}
+
+#endif
+
+#if vsm_arch_x86_avx512bw
+
+vsm_no_sanitize_address
+void _swiss_table_group_avx512::convert_special_to_empty_and_full_to_tomb(
+	_swiss_table_ctrl* const group)
+{
+	__m512i const ctrl = _swiss_table_group_avx512::load(group);
+
+	__m512i const empty = _mm512_set1_epi8(static_cast<char>(_swiss_table_ctrl::empty));
+	__m512i const tomb = _mm512_set1_epi8(static_cast<char>(_swiss_table_ctrl::tomb));
+
+	// Special values have the most significant bit set.
+	__mmask64 const special = _mm512_movepi8_mask(ctrl);
+	__m512i const result = _mm512_mask_blend_epi8(special, tomb, empty);
+
+	_swiss_table_group_avx512::store(group, result);
+}
+
+#endif
+
 
 using group_array = std::array<_swiss_table_ctrl, _swiss_table_group_size>;
 
@@ -60,6 +99,35 @@ size_t detail::_swiss_table_find_free(
 	}
 }
 
+size_t detail::_swiss_table_find_free_in_block(
+	_swiss_table_ctrl const* const ctrl,
+	size_t const capacity,
+	size_t const hash,
+	size_t const block_size)
+{
+	vsm_assert(std::has_single_bit(block_size) && block_size <= capacity);
+
+	_swiss_table_probe probe(_swiss_table_hash_1(hash), capacity);
+
+	size_t const block_begin = probe.offset & ~(block_size - 1);
+	size_t const block_end = block_begin + block_size;
+
+	// The offset wraps around when the probe leaves the last block of the table.
+	while (probe.offset >= block_begin && probe.offset + _swiss_table_group_size <= block_end)
+	{
+		_swiss_table_group const group(ctrl + probe.offset);
+
+		if (auto const mask = group.match_free())
+		{
+			return probe.offset + mask.countr_zero();
+		}
+
+		probe.next();
+	}
+
+	return static_cast<size_t>(-1);
+}
+
 // Converts
 // 1. _swiss_table_ctrl::tomb to _swiss_table_ctrl::empty, and
 // 2. any value indicating an element to _swiss_table_ctrl::tomb.
@@ -151,15 +219,16 @@ void detail::_swiss_table_erase_1(
 	auto const left_group_mask = _swiss_table_group(ctrl + left_index).match_empty();
 	auto const slot_group_mask = _swiss_table_group(ctrl + slot_index).match_empty();
 
-	size_t const left_group_r_zero = left_group_mask.countr_zero();
-	size_t const slot_group_l_zero = slot_group_mask.countl_zero();
+	// Number of consecutive non-empty slots immediately before and starting at the erased slot.
+	size_t const left_group_l_zero = left_group_mask.countl_zero();
+	size_t const slot_group_r_zero = slot_group_mask.countr_zero();
 
 	// The slot may be reused (marked as empty instead of tomb), if doing so does not create a full
 	// empty group that might cause subsequent probing to terminate early.
 	bool const may_reuse_slot =
 		left_group_mask &&
 		slot_group_mask &&
-		(left_group_r_zero + slot_group_l_zero) < _swiss_table_group_size;
+		(left_group_l_zero + slot_group_r_zero) < _swiss_table_group_size;
 
 	_swiss_table_ctrl_set_2(
 		ctrl,
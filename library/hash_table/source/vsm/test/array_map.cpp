@@ -3,8 +3,12 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
 #include <ranges>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 using namespace vsm;
 
@@ -130,4 +134,236 @@ TEMPLATE_LIST_TEST_CASE(
 		vsm_map | std::views::transform([](auto const& x) { return x.value; })));
 }
 
+TEMPLATE_LIST_TEST_CASE(
+	"array_map erase & find",
+	"[hash_table][array_table][array_map]",
+	map_types)
+{
+	using key_type = size_t;
+	using map_type = typename TestType::template type<key_type, key_type>;
+
+	map_type map;
+
+	for (size_t i = 0; i < 20; ++i)
+	{
+		REQUIRE(map.insert(i, 1000 + i).inserted);
+	}
+
+	// Erasing any but the last element shifts the indices of the elements following it.
+	for (size_t i = 0; i < 20; i += 2)
+	{
+		REQUIRE(map.erase(i) == 1);
+	}
+	REQUIRE(map.size() == 10);
+
+	for (size_t i = 0; i < 40; ++i)
+	{
+		auto const* const element = map.find_ptr(i);
+		REQUIRE((element != nullptr) == (i < 20 && i % 2 != 0));
+
+		if (element != nullptr)
+		{
+			CHECK(element->value == 1000 + i);
+		}
+	}
+
+	for (size_t i = 0; i < 20; i += 2)
+	{
+		REQUIRE(map.insert(i, 2000 + i).inserted);
+	}
+	REQUIRE(map.size() == 20);
+
+	for (size_t i = 0; i < 20; ++i)
+	{
+		auto const* const element = map.find_ptr(i);
+		REQUIRE(element != nullptr);
+		CHECK(element->value == (i % 2 == 0 ? 2000 : 1000) + i);
+	}
+}
+
+TEST_CASE("array_map with precomputed hash", "[hash_table][array_table][array_map]")
+{
+	array_map<std::string, size_t> map_1;
+	array_map<std::string, size_t> map_2;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		size_t const hash = map_1.hash(std::string_view(key));
+
+		CHECK(map_1.insert_with_hash(hash, key, i).inserted);
+		CHECK(map_2.insert_with_hash(hash, key, i * 2).inserted);
+		CHECK(!map_2.insert_with_hash(hash, key, i * 3).inserted);
+	}
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		std::string_view const key_view = key;
+		size_t const hash = map_2.hash(key_view);
+
+		auto const it_1 = map_1.find_with_hash(hash, key_view);
+		REQUIRE(it_1 != map_1.end());
+		CHECK(it_1->value == i);
+
+		auto const it_2 = std::as_const(map_2).find_with_hash(hash, key_view);
+		REQUIRE(it_2 != map_2.end());
+		CHECK(it_2->value == i * 2);
+
+		if (i % 2 == 0)
+		{
+			CHECK(map_1.erase_with_hash(hash, key_view) == 1);
+			CHECK(map_1.erase_with_hash(hash, key_view) == 0);
+			CHECK(map_1.find_with_hash(hash, key_view) == map_1.end());
+		}
+	}
+
+	CHECK(map_1.size() == 50);
+	CHECK(map_2.size() == 100);
+}
+
+TEST_CASE("array_map statistics", "[hash_table][array_table][array_map]")
+{
+	auto const sum = [](auto const& histogram)
+	{
+		size_t sum = 0;
+		for (size_t const count : histogram)
+		{
+			sum += count;
+		}
+		return sum;
+	};
+
+	array_map<size_t, size_t> map;
+	CHECK(map.statistics().size == 0);
+	CHECK(sum(map.statistics().displacement_histogram) == 0);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		map.insert(i, i);
+	}
+
+	auto const statistics = map.statistics();
+
+	CHECK(statistics.size == map.size());
+	CHECK(statistics.capacity == map.capacity());
+	CHECK(statistics.bucket_count > statistics.capacity);
+	CHECK(sum(statistics.displacement_histogram) == map.size());
+	CHECK(statistics.displacement_histogram[std::min(
+		statistics.max_displacement,
+		statistics.displacement_histogram.size() - 1)] != 0);
+}
+
+TEMPLATE_LIST_TEST_CASE("array_map insert_range", "[hash_table][array_table][array_map]", map_types)
+{
+	using map_type = typename TestType::template type<size_t, std::string>;
+
+	size_t const size = GENERATE(as<size_t>(), 0, 10, 1000);
+
+	std::vector<key_value_pair<size_t, std::string>> elements;
+	for (size_t i = 0; i < size; ++i)
+	{
+		elements.push_back({ size - i - 1, std::to_string(size - i - 1) });
+	}
+
+	auto const check_map = [&](map_type const& map)
+	{
+		REQUIRE(map.size() == size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto const* const element = map.find_ptr(i);
+			REQUIRE(element != nullptr);
+			CHECK(element->value == std::to_string(i));
+		}
+
+		// Elements are stored in the order of the range.
+		CHECK(std::ranges::equal(
+			map,
+			elements,
+			[](auto const& a, auto const& b) { return a.key == b.key; }));
+	};
+
+	SECTION("from range")
+	{
+		map_type const map(std::from_range, elements);
+		check_map(map);
+	}
+
+	SECTION("from range, unique keys")
+	{
+		map_type const map(std::from_range, unique_keys, elements);
+		check_map(map);
+	}
+
+	SECTION("duplicate keys")
+	{
+		auto duplicates = elements;
+		duplicates.insert(duplicates.end(), elements.begin(), elements.end());
+
+		map_type map;
+		map.insert_range(duplicates);
+		check_map(map);
+	}
+}
+
+TEMPLATE_LIST_TEST_CASE("array_map copy", "[hash_table][array_table][array_map]", map_types)
+{
+	using map_type = typename TestType::template type<size_t, std::string>;
+
+	auto const make_map = [](size_t const size, size_t const offset)
+	{
+		map_type map;
+		for (size_t i = 0; i < size; ++i)
+		{
+			map.insert(i + offset, std::to_string(i + offset));
+		}
+		return map;
+	};
+
+	auto const check_map = [](map_type const& map, size_t const size, size_t const offset)
+	{
+		REQUIRE(map.size() == size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto const* const element = map.find_ptr(i + offset);
+			REQUIRE(element != nullptr);
+			CHECK(element->value == std::to_string(i + offset));
+		}
+
+		// Iteration order is preserved.
+		size_t i = 0;
+		for (auto const& element : map)
+		{
+			CHECK(element.key == i++ + offset);
+		}
+	};
+
+	size_t const size = GENERATE(as<size_t>(), 0, 10, 1000);
+
+	map_type const map = make_map(size, 0);
+
+	SECTION("construction")
+	{
+		map_type copy = map;
+		check_map(copy, size, 0);
+
+		copy.insert(size, "");
+		CHECK(map.size() == size);
+	}
+
+	SECTION("assignment, equal capacity")
+	{
+		map_type copy = make_map(size, 1);
+		copy = map;
+		check_map(copy, size, 0);
+	}
+
+	SECTION("assignment, different capacity")
+	{
+		map_type copy = make_map(size == 1000 ? 10 : 1000, 1);
+		copy = map;
+		check_map(copy, size, 0);
+	}
+}
+
 } // namespace
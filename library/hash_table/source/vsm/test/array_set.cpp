@@ -0,0 +1,27 @@
+#include <vsm/array_set.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <string_view>
+
+using namespace vsm;
+
+TEST_CASE("array_set heterogeneous insert", "[hash_table][array_table]")
+{
+	array_set<std::string> set;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		REQUIRE(set.insert(std::string_view(key)).inserted);
+		REQUIRE(!set.insert(std::string_view(key)).inserted);
+	}
+	REQUIRE(set.size() == 100);
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		CHECK(set.contains(std::string_view(key)));
+	}
+}
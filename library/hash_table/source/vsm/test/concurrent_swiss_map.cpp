@@ -0,0 +1,101 @@
+#include <vsm/concurrent_swiss_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+TEST_CASE("concurrent_swiss_map single threaded", "[hash_table][swiss_table][concurrent_swiss_map]")
+{
+	concurrent_swiss_map<std::string, size_t, 4> map;
+
+	CHECK(map.insert("a", 1u));
+	CHECK(!map.insert("a", 2u));
+	CHECK(map.find("a") == 1u);
+
+	CHECK(!map.insert_or_assign("a", 3u));
+	CHECK(map.find("a") == 3u);
+
+	CHECK(map.insert_or_assign("b", 4u));
+	CHECK(map.contains("b"));
+	CHECK(map.size() == 2);
+
+	size_t sum = 0;
+	map.visit_all([&](auto const& element)
+	{
+		sum += element.value;
+	});
+	CHECK(sum == 7);
+
+	CHECK(map.erase("a") == 1);
+	CHECK(map.erase("a") == 0);
+	CHECK(!map.find("a"));
+	CHECK(map.size() == 1);
+
+	map.clear();
+	CHECK(map.size() == 0);
+}
+
+TEST_CASE("concurrent_swiss_map multi threaded", "[hash_table][swiss_table][concurrent_swiss_map]")
+{
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t keys_per_thread = 10'000;
+
+	concurrent_swiss_map<size_t, size_t> map;
+	std::atomic<size_t> lookup_failures = 0;
+
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < thread_count; ++t)
+	{
+		threads.emplace_back([&map, &lookup_failures, t]()
+		{
+			size_t const first_key = t * keys_per_thread;
+
+			for (size_t i = 0; i < keys_per_thread; ++i)
+			{
+				size_t const key = first_key + i;
+
+				map.insert(key, key * 2);
+
+				// Look up keys inserted by this thread as well as keys of other threads, which may
+				// or may not have been inserted yet.
+				if (map.find(key) != key * 2)
+				{
+					++lookup_failures;
+				}
+
+				size_t const other_key = (key + keys_per_thread) % (thread_count * keys_per_thread);
+				if (auto const value = map.find(other_key); value && *value != other_key * 2)
+				{
+					++lookup_failures;
+				}
+
+				if (i % 2 == 1)
+				{
+					map.erase(key);
+				}
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	CHECK(lookup_failures == 0);
+	CHECK(map.size() == thread_count * keys_per_thread / 2);
+
+	for (size_t key = 0; key < thread_count * keys_per_thread; ++key)
+	{
+		CHECK(map.contains(key) == (key % 2 == 0));
+	}
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+#include <vsm/dense_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+template<typename Allocator, size_t Capacity>
+struct map_template
+{
+	template<typename K, typename V>
+	using type = small_dense_map<K, V, Capacity, default_key_selector, Allocator>;
+};
+
+using map_types = std::tuple<
+	map_template<default_allocator, 0>,
+	map_template<default_allocator, 15>
+>;
+
+TEMPLATE_LIST_TEST_CASE(
+	"elements can be erased from a dense_map",
+	"[hash_table][array_table][dense_map]",
+	map_types)
+{
+	using key_type = std::string;
+	using map_type = typename TestType::template type<key_type, size_t>;
+
+	size_t const count = GENERATE(as<size_t>(), 1, 10, 100, 1000);
+
+	map_type map;
+	std::unordered_map<key_type, size_t> std_map;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		REQUIRE(map.insert(std::to_string(i), i).inserted);
+		std_map.emplace(std::to_string(i), i);
+	}
+
+	std::vector<size_t> erase_order(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		erase_order[i] = i;
+	}
+	std::ranges::shuffle(erase_order, Catch::sharedRng());
+
+	for (size_t const i : erase_order)
+	{
+		REQUIRE(map.erase(std::to_string(i)) == 1);
+		REQUIRE(map.erase(std::to_string(i)) == 0);
+		std_map.erase(std::to_string(i));
+
+		REQUIRE(map.size() == std_map.size());
+		REQUIRE(static_cast<size_t>(map.end() - map.begin()) == map.size());
+
+		for (auto const& [key, value] : std_map)
+		{
+			auto const it = map.find(key);
+			REQUIRE(it != map.end());
+			CHECK(it->value == value);
+		}
+	}
+
+	CHECK(map.empty());
+}
+
+// Throws when hashing throwing_key.
+struct throwing_hasher
+{
+	static inline size_t throwing_key = static_cast<size_t>(-1);
+
+	size_t operator()(size_t const key) const
+	{
+		if (key == throwing_key)
+		{
+			throw std::runtime_error("hasher failure");
+		}
+		return default_hasher()(key);
+	}
+};
+
+TEST_CASE("dense_map erase with throwing hasher", "[hash_table][array_table][dense_map]")
+{
+	dense_map<size_t, std::string, default_key_selector, default_allocator, throwing_hasher> map;
+
+	for (size_t i = 0; i < 10; ++i)
+	{
+		REQUIRE(map.insert(i, std::to_string(i)).inserted);
+	}
+
+	// Erasing any element but the last hashes the last element in order to move it.
+	throwing_hasher::throwing_key = 9;
+	CHECK_THROWS_AS(map.erase(size_t(3)), std::runtime_error);
+	throwing_hasher::throwing_key = static_cast<size_t>(-1);
+
+	REQUIRE(map.size() == 10);
+	for (size_t i = 0; i < 10; ++i)
+	{
+		auto const it = map.find(i);
+		REQUIRE(it != map.end());
+		CHECK(it->value == std::to_string(i));
+	}
+
+	CHECK(map.erase(size_t(3)) == 1);
+	CHECK(map.size() == 9);
+	CHECK(!map.contains(size_t(3)));
+	CHECK(map.at(size_t(9)) == "9");
+}
+
+} // namespace
@@ -0,0 +1,209 @@
+#include <vsm/hashed_swiss_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace vsm;
+
+namespace {
+
+struct counting_hasher
+{
+	size_t* count;
+
+	template<typename T>
+	size_t operator()(T const& value) const
+	{
+		++*count;
+		return default_hasher()(value);
+	}
+};
+
+// Maps every key onto a few hashes, such that most keys compare equal by hash.
+struct colliding_hasher
+{
+	size_t operator()(std::string_view const value) const
+	{
+		return value.size() % 4;
+	}
+};
+
+struct throwing_value
+{
+	size_t value;
+
+	explicit throwing_value(size_t const value)
+		: value(value)
+	{
+		if (value == 13)
+		{
+			throw std::runtime_error("throwing_value");
+		}
+	}
+};
+
+TEST_CASE("hashed_swiss_map", "[hash_table][swiss_table][hashed_swiss_map]")
+{
+	hashed_swiss_map<std::string, size_t> map;
+	std::unordered_map<std::string, size_t> std_map;
+
+	auto const check_equal = [&]()
+	{
+		REQUIRE(map.size() == std_map.size());
+
+		for (auto const& [key, value] : std_map)
+		{
+			auto const* const element = std::as_const(map).find_ptr(key);
+			REQUIRE(element != nullptr);
+			REQUIRE(element->value == value);
+		}
+
+		size_t iterated_size = 0;
+		for (auto const& element : std::as_const(map))
+		{
+			auto const it = std_map.find(element.key);
+			REQUIRE(it != std_map.end());
+			REQUIRE(it->second == element.value);
+			++iterated_size;
+		}
+		REQUIRE(iterated_size == std_map.size());
+	};
+
+	for (size_t i = 0; i < 2000; ++i)
+	{
+		std::string const key = "https://example.com/some/long/path/" + std::to_string(i);
+
+		CHECK(map.insert(key, i).inserted);
+		CHECK(!map.insert(key, 0u).inserted);
+		std_map.emplace(key, i);
+
+		if (i % 3 == 0)
+		{
+			std::string const erase_key = "https://example.com/some/long/path/" + std::to_string(i / 2);
+			CHECK(map.erase(erase_key) == std_map.erase(erase_key));
+		}
+
+		if (i % 5 == 0)
+		{
+			std::string const assign_key = "https://example.com/some/long/path/" + std::to_string(i / 4);
+			if (auto const it = std_map.find(assign_key); it != std_map.end())
+			{
+				CHECK(!map.insert_or_assign(assign_key, i).inserted);
+				it->second = i;
+			}
+		}
+	}
+	check_equal();
+
+	std::string_view const key = "https://example.com/some/long/path/1999";
+	CHECK(map.contains(key));
+	CHECK(map.at(key) == 1999);
+
+	auto const it = map.find(key);
+	REQUIRE(it != map.end());
+	map.erase(it);
+	std_map.erase(std::string(key));
+	check_equal();
+
+	CHECK(map.at_ptr(key) == nullptr);
+	CHECK_THROWS_AS(map.at(key), std::out_of_range);
+
+	auto const copy = map;
+	CHECK(copy.size() == map.size());
+
+	map.clear();
+	CHECK(map.empty());
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("hashed_swiss_map does not rehash keys", "[hash_table][swiss_table][hashed_swiss_map]")
+{
+	size_t hash_count = 0;
+
+	using map_type = hashed_swiss_map<
+		std::string,
+		size_t,
+		default_key_selector,
+		default_allocator,
+		counting_hasher>;
+
+	map_type map(map_type::policies_type{ {}, counting_hasher{ &hash_count }, {} });
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		map.insert(std::to_string(i), i);
+	}
+	CHECK(hash_count == 1000);
+
+	map.reserve(10000);
+	CHECK(hash_count == 1000);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(map.at(std::to_string(i)) == i);
+	}
+	CHECK(hash_count == 2000);
+}
+
+TEST_CASE("hashed_swiss_map hash collisions", "[hash_table][swiss_table][hashed_swiss_map]")
+{
+	hashed_swiss_map<
+		std::string,
+		size_t,
+		default_key_selector,
+		default_allocator,
+		colliding_hasher> map;
+
+	for (size_t i = 0; i < 200; ++i)
+	{
+		REQUIRE(map.insert(std::to_string(i), i).inserted);
+	}
+
+	for (size_t i = 0; i < 200; ++i)
+	{
+		REQUIRE(map.at(std::to_string(i)) == i);
+	}
+	CHECK(!map.contains(std::string("200")));
+}
+
+TEST_CASE("hashed_swiss_map throwing constructor", "[hash_table][swiss_table][hashed_swiss_map]")
+{
+	hashed_swiss_map<std::string, throwing_value> map;
+
+	// Long keys are allocated on the heap, such that destroying the unconstructed key is detected.
+	auto const make_key = [](size_t const i)
+	{
+		return std::string(100, 'x') + std::to_string(i);
+	};
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		if (i == 13)
+		{
+			REQUIRE_THROWS_AS(map.try_emplace(make_key(i), i), std::runtime_error);
+		}
+		else
+		{
+			REQUIRE(map.try_emplace(make_key(i), i).inserted);
+		}
+	}
+	REQUIRE(map.size() == 99);
+	CHECK(!map.contains(make_key(13)));
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		if (i != 13)
+		{
+			REQUIRE(map.at(make_key(i)).value == i);
+		}
+	}
+
+	REQUIRE(map.try_emplace(make_key(13), size_t(14)).inserted);
+	CHECK(map.at(make_key(13)).value == 14);
+}
+
+} // namespace
@@ -0,0 +1,108 @@
+#include <vsm/incremental_swiss_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <unordered_map>
+
+using namespace vsm;
+
+namespace {
+
+TEST_CASE("incremental_swiss_map", "[hash_table][swiss_table][incremental_swiss_map]")
+{
+	incremental_swiss_map<std::string, size_t> map;
+	std::unordered_map<std::string, size_t> std_map;
+
+	auto const check_equal = [&]()
+	{
+		REQUIRE(map.size() == std_map.size());
+
+		for (auto const& [key, value] : std_map)
+		{
+			auto const* const element = std::as_const(map).find_ptr(key);
+			REQUIRE(element != nullptr);
+			REQUIRE(element->value == value);
+		}
+
+		size_t iterated_size = 0;
+		for (auto const& element : std::as_const(map))
+		{
+			auto const it = std_map.find(element.key);
+			REQUIRE(it != std_map.end());
+			REQUIRE(it->second == element.value);
+			++iterated_size;
+		}
+		REQUIRE(iterated_size == std_map.size());
+	};
+
+	bool observed_migration = false;
+
+	for (size_t i = 0; i < 5000; ++i)
+	{
+		std::string const key = std::to_string(i);
+
+		CHECK(map.insert(key, i).inserted);
+		CHECK(!map.insert(key, 0u).inserted);
+		std_map.emplace(key, i);
+
+		// Erase some earlier keys, which may reside in either table.
+		if (i % 3 == 0)
+		{
+			std::string const erase_key = std::to_string(i / 2);
+			CHECK(map.erase(erase_key) == std_map.erase(erase_key));
+		}
+
+		// Reassign some existing keys, which may reside in either table.
+		if (i % 5 == 0)
+		{
+			std::string const assign_key = std::to_string(i / 4);
+			if (auto const it = std_map.find(assign_key); it != std_map.end())
+			{
+				CHECK(!map.insert_or_assign(assign_key, i).inserted);
+				it->second = i;
+			}
+		}
+
+		if (map.is_migrating())
+		{
+			observed_migration = true;
+			check_equal();
+		}
+	}
+
+	CHECK(observed_migration);
+	check_equal();
+
+	map.clear();
+	CHECK(map.empty());
+	CHECK(map.begin() == map.end());
+	CHECK(!map.is_migrating());
+}
+
+TEST_CASE("incremental_swiss_map reserve", "[hash_table][swiss_table][incremental_swiss_map]")
+{
+	incremental_swiss_map<size_t, size_t> map;
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		map.insert(i, i);
+	}
+
+	CHECK(!map.try_emplace(size_t(0), size_t(1)).inserted);
+	CHECK(map.at(size_t(0)) == 0);
+	CHECK(map.at_ptr(size_t(1000)) == nullptr);
+
+	map.reserve(10000);
+	CHECK(!map.is_migrating());
+	CHECK(map.size() == 1000);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		auto const* const element = map.find_ptr(i);
+		REQUIRE(element != nullptr);
+		CHECK(element->value == i);
+	}
+}
+
+} // namespace
@@ -0,0 +1,220 @@
+#include <vsm/mapped_swiss_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <cstring>
+
+using namespace vsm;
+
+namespace {
+
+using mapped_map_type = mapped_swiss_map<uint64_t, uint64_t>;
+
+template<size_t Capacity = 0>
+using source_map_type = small_swiss_map<
+	uint64_t,
+	uint64_t,
+	Capacity,
+	default_key_selector,
+	default_allocator,
+	stable_hasher>;
+
+// Hashes keys differently from stable_hasher.
+struct other_hasher
+{
+	size_t operator()(uint64_t const key) const
+	{
+		return stable_hasher()(key + 1);
+	}
+};
+
+struct alignas(mapped_map_type::image_alignment) image_block
+{
+	std::byte data[mapped_map_type::image_alignment];
+};
+
+struct image_buffer
+{
+	std::vector<image_block> blocks;
+
+	explicit image_buffer(size_t const size)
+		: blocks((size + sizeof(image_block) - 1) / sizeof(image_block))
+	{
+	}
+
+	std::span<std::byte> bytes()
+	{
+		return std::span(
+			reinterpret_cast<std::byte*>(blocks.data()),
+			blocks.size() * sizeof(image_block));
+	}
+};
+
+template<typename Map>
+image_buffer write_image(Map const& map)
+{
+	image_buffer buffer(mapped_map_type::image_size(map));
+	size_t const size = mapped_map_type::write_image(map, buffer.bytes());
+	CHECK(size == mapped_map_type::image_size(map));
+	return buffer;
+}
+
+TEST_CASE("mapped_swiss_map", "[hash_table][swiss_table][mapped_swiss_map]")
+{
+	size_t const size = GENERATE(as<size_t>(), 0, 1, 1000);
+
+	source_map_type<> map;
+	for (uint64_t i = 0; i < size; ++i)
+	{
+		map.insert(i, i * 3);
+	}
+
+	auto const original = write_image(map);
+
+	// The image is position independent.
+	image_buffer relocated(original.blocks.size() * sizeof(image_block));
+	std::memcpy(relocated.blocks.data(), original.blocks.data(), relocated.bytes().size());
+
+	mapped_map_type const mapped(relocated.bytes());
+	REQUIRE(mapped.size() == size);
+	CHECK(mapped.capacity() == map.capacity());
+
+	for (uint64_t i = 0; i < size; ++i)
+	{
+		auto const* const element = mapped.find_ptr(i);
+		REQUIRE(element != nullptr);
+		CHECK(element->key == i);
+		CHECK(element->value == i * 3);
+		CHECK(mapped.at(i) == i * 3);
+	}
+
+	for (uint64_t i = size; i < size * 2 + 10; ++i)
+	{
+		CHECK(!mapped.contains(i));
+		CHECK(mapped.at_ptr(i) == nullptr);
+	}
+
+	size_t iterated_size = 0;
+	for (auto const& element : mapped)
+	{
+		CHECK(element.value == element.key * 3);
+		++iterated_size;
+	}
+	CHECK(iterated_size == size);
+}
+
+TEST_CASE("mapped_swiss_map from small_swiss_map with tombstones", "[hash_table][swiss_table][mapped_swiss_map]")
+{
+	source_map_type<15> map;
+	for (uint64_t i = 0; i < 10; ++i)
+	{
+		map.insert(i, i);
+	}
+	map.erase(uint64_t(5));
+
+	auto buffer = write_image(map);
+	mapped_map_type const mapped(buffer.bytes());
+
+	REQUIRE(mapped.size() == 9);
+	CHECK(!mapped.contains(uint64_t(5)));
+	for (uint64_t i = 0; i < 10; ++i)
+	{
+		CHECK(mapped.contains(i) == (i != 5));
+	}
+}
+
+TEST_CASE("mapped_swiss_map default constructor", "[hash_table][swiss_table][mapped_swiss_map]")
+{
+	mapped_map_type const mapped;
+	CHECK(mapped.empty());
+	CHECK(!mapped.contains(uint64_t(0)));
+	CHECK(mapped.begin() == mapped.end());
+}
+
+TEST_CASE("mapped_swiss_map rejects invalid images", "[hash_table][swiss_table][mapped_swiss_map]")
+{
+	source_map_type<> map;
+	map.insert(uint64_t(1), uint64_t(2));
+
+	auto buffer = write_image(map);
+	auto const bytes = buffer.bytes();
+
+	SECTION("truncated")
+	{
+		size_t const image_size = mapped_map_type::image_size(map);
+		CHECK_THROWS_AS(mapped_map_type(bytes.first(image_size - 1)), std::invalid_argument);
+	}
+
+	SECTION("misaligned")
+	{
+		CHECK_THROWS_AS(mapped_map_type(bytes.subspan(1)), std::invalid_argument);
+	}
+
+	SECTION("bad magic")
+	{
+		bytes[0] = std::byte(~static_cast<unsigned char>(bytes[0]));
+		CHECK_THROWS_AS(mapped_map_type(bytes), std::invalid_argument);
+	}
+
+	SECTION("different element type")
+	{
+		CHECK_THROWS_AS((mapped_swiss_map<uint32_t, uint32_t>(bytes)), std::invalid_argument);
+	}
+
+	SECTION("different hasher")
+	{
+		using other_map_type = mapped_swiss_map<
+			uint64_t,
+			uint64_t,
+			default_key_selector,
+			other_hasher>;
+
+		CHECK_THROWS_AS(other_map_type(bytes), std::invalid_argument);
+	}
+}
+
+TEST_CASE("mapped_swiss_map image zeroes empty slots", "[hash_table][swiss_table][mapped_swiss_map]")
+{
+	source_map_type<> map;
+	for (uint64_t i = 1; i <= 100; ++i)
+	{
+		map.insert(i, i);
+	}
+	for (uint64_t i = 1; i <= 100; i += 2)
+	{
+		map.erase(i);
+	}
+
+	image_buffer buffer(mapped_map_type::image_size(map));
+	std::ranges::fill(buffer.bytes(), std::byte(0xAA));
+	(void)mapped_map_type::write_image(map, buffer.bytes());
+
+	auto const& header = *reinterpret_cast<detail::_swiss_table_image_header const*>(
+		buffer.bytes().data());
+
+	size_t const capacity = header.capacity;
+	size_t const slot_size = sizeof(key_value_pair<uint64_t, uint64_t>);
+
+	auto const storage = const_cast<unsigned char*>(header.storage.get());
+	auto const ctrl = detail::_swiss_table_ctrl_ptr(storage, capacity, slot_size);
+
+	for (size_t i = 0; i < capacity; ++i)
+	{
+		if (detail::_swiss_table_ctrl_get(ctrl, i) < static_cast<detail::_swiss_table_ctrl>(0))
+		{
+			auto const slot = storage + i * slot_size;
+			REQUIRE(std::all_of(slot, slot + slot_size, [](auto const x) { return x == 0; }));
+		}
+	}
+
+	mapped_map_type const mapped(buffer.bytes());
+	for (uint64_t i = 1; i <= 100; ++i)
+	{
+		CHECK(mapped.contains(i) == (i % 2 == 0));
+	}
+}
+
+} // namespace
@@ -0,0 +1,119 @@
+#include <vsm/split_swiss_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using namespace vsm;
+
+namespace {
+
+TEST_CASE("split_swiss_map", "[hash_table][swiss_table][split_swiss_map]")
+{
+	split_swiss_map<uint32_t, std::string> map;
+	std::unordered_map<uint32_t, std::string> std_map;
+
+	auto const check_equal = [&]()
+	{
+		REQUIRE(map.size() == std_map.size());
+
+		for (auto const& [key, value] : std_map)
+		{
+			auto const* const element = std::as_const(map).at_ptr(key);
+			REQUIRE(element != nullptr);
+			REQUIRE(*element == value);
+		}
+
+		size_t iterated_size = 0;
+		for (auto const [key, value] : std::as_const(map))
+		{
+			auto const it = std_map.find(key);
+			REQUIRE(it != std_map.end());
+			REQUIRE(it->second == value);
+			++iterated_size;
+		}
+		REQUIRE(iterated_size == std_map.size());
+
+		size_t iterated_value_count = 0;
+		for ([[maybe_unused]] std::string const& value : std::as_const(map).values())
+		{
+			++iterated_value_count;
+		}
+		REQUIRE(iterated_value_count == std_map.size());
+	};
+
+	for (uint32_t i = 0; i < 5000; ++i)
+	{
+		std::string const value = std::to_string(i);
+
+		CHECK(map.insert(i, value).inserted);
+		CHECK(!map.insert(i, std::string()).inserted);
+		std_map.emplace(i, value);
+
+		if (i % 3 == 0)
+		{
+			CHECK(map.erase(i / 2) == std_map.erase(i / 2));
+		}
+
+		if (i % 5 == 0)
+		{
+			if (auto const it = std_map.find(i / 4); it != std_map.end())
+			{
+				CHECK(!map.insert_or_assign(i / 4, std::string("assigned")).inserted);
+				it->second = "assigned";
+			}
+		}
+	}
+	check_equal();
+
+	auto const it = map.find(4999u);
+	REQUIRE(it != map.end());
+	CHECK(it->key == 4999);
+	CHECK(it->value == "4999");
+	map.erase(it);
+	std_map.erase(4999);
+	check_equal();
+
+	CHECK(map.find(4999u) == map.end());
+	CHECK_THROWS_AS(map.at(4999u), std::out_of_range);
+
+	for (std::string& value : map.values())
+	{
+		value += '!';
+	}
+	for (auto const& [key, value] : std_map)
+	{
+		REQUIRE(map.at(key) == value + '!');
+	}
+
+	auto moved_map = std::move(map);
+	CHECK(moved_map.size() == std_map.size());
+	CHECK(map.empty());
+
+	moved_map.clear();
+	CHECK(moved_map.empty());
+	CHECK(moved_map.begin() == moved_map.end());
+}
+
+TEST_CASE("split_swiss_map reserve", "[hash_table][swiss_table][split_swiss_map]")
+{
+	split_swiss_map<uint64_t, std::unique_ptr<uint64_t>> map;
+
+	for (uint64_t i = 0; i < 1000; ++i)
+	{
+		CHECK(map.try_emplace(i, std::make_unique<uint64_t>(i)).inserted);
+	}
+
+	map.reserve(10000);
+	CHECK(map.capacity() >= 10000);
+	CHECK(map.size() == 1000);
+
+	for (uint64_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(*map.at(i) == i);
+	}
+}
+
+} // namespace
@@ -0,0 +1,277 @@
+#include <vsm/static_hash_map.hpp>
+
+#include <vsm/default_hash.hpp>
+#include <vsm/testing/allocator.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+constexpr auto keywords = make_static_hash_map<std::string_view, int>(
+{
+	{ "break", 0 },
+	{ "case", 1 },
+	{ "continue", 2 },
+	{ "default", 3 },
+	{ "do", 4 },
+	{ "else", 5 },
+	{ "for", 6 },
+	{ "goto", 7 },
+	{ "if", 8 },
+	{ "return", 9 },
+	{ "switch", 10 },
+	{ "while", 11 },
+	{ "a_very_long_keyword_spanning_multiple_words", 12 },
+});
+
+static_assert(keywords.size() == 13);
+static_assert(keywords.at("break") == 0);
+static_assert(keywords.at("while") == 11);
+static_assert(keywords.at("a_very_long_keyword_spanning_multiple_words") == 12);
+static_assert(keywords.contains("goto"));
+static_assert(!keywords.contains("throw"));
+static_assert(!keywords.contains(""));
+static_assert(keywords.find("register") == keywords.end());
+
+constexpr auto empty_map = static_hash_map<int, int, 0>();
+static_assert(empty_map.empty());
+static_assert(!empty_map.contains(0));
+
+// Keys customizing hash_append are hashed using the same hash_append machinery as other maps.
+struct point
+{
+	int x;
+	int y;
+
+	template<typename State>
+	friend constexpr void tag_invoke(decltype(hash_append), State& state, point const& p)
+	{
+		hash_append(state, p.x);
+		hash_append(state, p.y);
+	}
+
+	bool operator==(point const&) const = default;
+};
+
+constexpr auto points = make_static_hash_map<point, std::string_view>(
+{
+	{ { 0, 0 }, "origin" },
+	{ { 1, 0 }, "x" },
+	{ { 0, 1 }, "y" },
+	{ { 1, 1 }, "xy" },
+});
+
+static_assert(points.at(point{ 1, 0 }) == "x");
+static_assert(points.at(point{ 1, 1 }) == "xy");
+static_assert(*points.at_ptr(point{ 0, 0 }) == "origin");
+static_assert(points.find_ptr(point{ 0, 1 })->value == "y");
+static_assert(points.count(point{ 2, 2 }) == 0);
+
+static_assert(std::is_same_v<
+	static_hash_map<int, int>::policies_type::hasher_type,
+	default_hasher>);
+static_assert(std::is_same_v<
+	static_hash_map<int, int, 1>::policies_type::hasher_type,
+	constexpr_hasher>);
+
+} // namespace
+
+TEST_CASE("static_hash_map constexpr", "[hash_table][static_hash_map]")
+{
+	size_t count = 0;
+	for (auto const& [key, value] : keywords)
+	{
+		CHECK(keywords.at(key) == value);
+		++count;
+	}
+	CHECK(count == keywords.size());
+
+	std::string const key = "continue";
+	CHECK(keywords.at(std::string_view(key)) == 2);
+	CHECK(keywords.at(key) == 2);
+
+	// The hashes computed at run time match those computed when building the map.
+	int const x = GENERATE(0, 1);
+	int const y = GENERATE(0, 1);
+	CHECK(points.contains(point{ x, y }));
+	CHECK(!points.contains(point{ x + 2, y }));
+}
+
+TEMPLATE_TEST_CASE("static_hash_map dynamic", "[hash_table][static_hash_map]",
+	constexpr_hasher,
+	default_hasher)
+{
+	static constexpr size_t element_count = 10'000;
+
+	std::vector<std::pair<int, int>> elements;
+	for (size_t i = 0; i < element_count; ++i)
+	{
+		int const key = static_cast<int>(i * 7);
+		elements.emplace_back(key, -key);
+	}
+
+	auto const map = static_hash_map<int, int, std::dynamic_extent, TestType>(
+		std::from_range,
+		elements);
+
+	REQUIRE(map.size() == element_count);
+
+	for (size_t i = 0; i < element_count * 7; ++i)
+	{
+		int const key = static_cast<int>(i);
+		if (i % 7 == 0)
+		{
+			REQUIRE(map.contains(key));
+			REQUIRE(map.at(key) == -key);
+		}
+		else
+		{
+			REQUIRE(!map.contains(key));
+			REQUIRE(map.at_ptr(key) == nullptr);
+		}
+	}
+}
+
+TEST_CASE("static_hash_map string keys", "[hash_table][static_hash_map]")
+{
+	std::vector<key_value_pair<std::string, size_t>> elements;
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		elements.push_back({ "key_" + std::to_string(i), i });
+	}
+
+	auto const map = static_hash_map<std::string, size_t, std::dynamic_extent, default_hasher>(
+		std::from_range,
+		elements);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(map.at("key_" + std::to_string(i)) == i);
+	}
+	CHECK(!map.contains(std::string("key_1000")));
+}
+
+TEST_CASE("static_hash_map empty", "[hash_table][static_hash_map]")
+{
+	static_hash_map<int, int> const map;
+	CHECK(map.empty());
+	CHECK(map.begin() == map.end());
+	CHECK(!map.contains(0));
+
+	auto const map_2 = static_hash_map<int, int>(std::from_range, std::vector<std::pair<int, int>>());
+	CHECK(map_2.empty());
+	CHECK(!map_2.contains(0));
+}
+
+TEST_CASE("static_hash_map duplicate keys", "[hash_table][static_hash_map]")
+{
+	std::vector<std::pair<int, int>> const elements = { { 1, 1 }, { 2, 2 }, { 1, 3 } };
+	CHECK_THROWS_AS((static_hash_map<int, int>(std::from_range, elements)), std::invalid_argument);
+	CHECK_THROWS_WITH(
+		(static_hash_map<int, int>(std::from_range, elements)),
+		"duplicate keys in static_hash_map");
+}
+
+TEST_CASE("static_hash_map colliding hashes", "[hash_table][static_hash_map]")
+{
+	// Maps pairs of distinct keys onto equal hashes.
+	struct colliding_hasher
+	{
+		size_t operator()(int const key) const
+		{
+			return static_cast<size_t>(key / 2);
+		}
+	};
+
+	using map_type = static_hash_map<int, int, std::dynamic_extent, colliding_hasher>;
+
+	std::vector<std::pair<int, int>> const elements = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+	CHECK_THROWS_WITH(
+		(map_type(std::from_range, elements)),
+		"colliding key hashes in static_hash_map");
+
+	std::vector<std::pair<int, int>> const distinct_elements = { { 1, 1 }, { 2, 2 }, { 4, 4 } };
+	map_type const map(std::from_range, distinct_elements);
+	CHECK(map.at(1) == 1);
+	CHECK(map.at(2) == 2);
+	CHECK(map.at(4) == 4);
+	CHECK(!map.contains(3));
+}
+
+TEST_CASE("static_hash_map allocator", "[hash_table][static_hash_map]")
+{
+	// Neither the key nor the value is default constructible.
+	struct key
+	{
+		int value;
+
+		explicit key(int const value)
+			: value(value)
+		{
+		}
+
+		bool operator==(key const&) const = default;
+	};
+
+	struct key_hasher
+	{
+		size_t operator()(key const& key) const
+		{
+			return constexpr_hash::mix(static_cast<uint64_t>(key.value));
+		}
+	};
+
+	using map_type = static_hash_map<
+		key,
+		std::string,
+		std::dynamic_extent,
+		key_hasher,
+		std::equal_to<>,
+		test::allocator>;
+
+	// The elements of an unsized range are built directly into the storage of the map.
+	auto elements = std::views::iota(0, 1000)
+		| std::views::filter([](int const i) { return i % 3 != 0; })
+		| std::views::transform([](int const i)
+		{
+			return std::pair<key, std::string>(key(i), std::to_string(i));
+		});
+
+	test::allocation_scope const scope;
+	{
+		map_type map(std::from_range, elements);
+		CHECK(map.size() == 666);
+
+		map_type const map_2 = std::move(map);
+		CHECK(map_2.size() == 666);
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			if (i % 3 != 0)
+			{
+				REQUIRE(map_2.at(key(i)) == std::to_string(i));
+			}
+			else
+			{
+				REQUIRE(!map_2.contains(key(i)));
+			}
+		}
+
+		std::vector<std::pair<key, std::string>> const duplicate_elements =
+		{
+			{ key(1), "1" },
+			{ key(2), "2" },
+			{ key(1), "3" },
+		};
+		CHECK_THROWS_AS((map_type(std::from_range, duplicate_elements)), std::invalid_argument);
+	}
+}
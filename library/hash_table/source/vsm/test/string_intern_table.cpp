@@ -0,0 +1,190 @@
+#include <vsm/string_intern_table.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+static_assert(monotonic_memory_resource<detail::_string_intern_arena<default_allocator>>);
+
+// Fails all allocations while the flag is set.
+class failing_string_resource
+{
+	using arena_type = detail::_string_intern_arena<default_allocator>;
+
+	arena_type m_arena;
+	bool const* m_fail;
+
+public:
+	using position_type = arena_type::position_type;
+
+	explicit failing_string_resource(bool const& fail)
+		: m_fail(&fail)
+	{
+	}
+
+	[[nodiscard]] allocation allocate(size_t const min_size, size_t const max_size) noexcept
+	{
+		return *m_fail ? allocation(nullptr) : m_arena.allocate(min_size, max_size);
+	}
+
+	void deallocate(allocation const allocation) noexcept
+	{
+		m_arena.deallocate(allocation);
+	}
+
+	[[nodiscard]] position_type get_position() const noexcept
+	{
+		return m_arena.get_position();
+	}
+
+	void reset_position(position_type const& position) noexcept
+	{
+		m_arena.reset_position(position);
+	}
+};
+static_assert(monotonic_memory_resource<failing_string_resource>);
+
+TEST_CASE("string_intern_table", "[hash_table][string_intern_table]")
+{
+	string_intern_table<> table;
+	std::unordered_map<std::string, uint32_t> std_map;
+	std::vector<std::string_view> views;
+
+	for (size_t i = 0; i < 5000; ++i)
+	{
+		std::string const string = "https://example.com/some/path/" + std::to_string(i % 3000);
+
+		auto const id = table.intern_id(string);
+		auto const [it, inserted] = std_map.try_emplace(string, id);
+
+		if (inserted)
+		{
+			REQUIRE(id == views.size());
+			views.push_back(table.get(id));
+		}
+		else
+		{
+			REQUIRE(id == it->second);
+		}
+
+		std::string_view const view = table.intern(string);
+		REQUIRE(view == string);
+		REQUIRE(view.data() == views[id].data());
+	}
+	REQUIRE(table.size() == 3000);
+
+	for (auto const& [string, id] : std_map)
+	{
+		REQUIRE(table.contains(string));
+		REQUIRE(table.find_id(string) == id);
+		REQUIRE(table.find(string) == string);
+		REQUIRE(table[id] == string);
+		REQUIRE(table[id].data() == views[id].data());
+	}
+
+	CHECK(!table.contains("https://example.com/some/path/3000"));
+	CHECK(table.find_id("https://example.com/some/path/3000") == table.invalid_id);
+	CHECK(!table.find("https://example.com/some/path/3000"));
+
+	auto moved_table = std::move(table);
+	CHECK(moved_table.size() == 3000);
+	CHECK(moved_table.get(0).data() == views[0].data());
+
+	moved_table.clear();
+	CHECK(moved_table.empty());
+	CHECK(!moved_table.contains(std_map.begin()->first));
+
+	CHECK(moved_table.intern_id("b") == 0);
+	CHECK(moved_table.intern_id("a") == 1);
+	CHECK(moved_table.intern_id("b") == 0);
+	CHECK(moved_table.get(1) == "a");
+}
+
+TEST_CASE("string_intern_table empty and long strings", "[hash_table][string_intern_table]")
+{
+	string_intern_table<> table;
+
+	CHECK(table.intern_id("") == 0);
+	CHECK(table.intern_id("") == 0);
+	CHECK(table.get(0).empty());
+
+	// Larger than the first chunk of the string arena.
+	std::string const long_string(100000, 'x');
+	CHECK(table.intern(long_string) == long_string);
+	CHECK(table.intern_id(long_string) == 1);
+
+	for (size_t i = 1; i < 100; ++i)
+	{
+		REQUIRE(table.intern_id(std::string(i, 'y')) == i + 1);
+	}
+	for (size_t i = 1; i < 100; ++i)
+	{
+		REQUIRE(table.get(static_cast<uint32_t>(i + 1)) == std::string(i, 'y'));
+	}
+	CHECK(table.get(1) == long_string);
+}
+
+TEST_CASE("string_intern_table reserve", "[hash_table][string_intern_table]")
+{
+	string_intern_table<> table;
+	table.reserve(1000);
+	CHECK(table.capacity() >= 1000);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(table.intern_id(std::to_string(i)) == i);
+	}
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(table.get(static_cast<uint32_t>(i)) == std::to_string(i));
+	}
+}
+
+TEST_CASE("string_intern_table failing string allocation", "[hash_table][string_intern_table]")
+{
+	bool fail = false;
+	string_intern_table<default_allocator, default_hasher, failing_string_resource> table(
+		failing_string_resource{ fail });
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		fail = i % 10 == 3;
+
+		if (fail)
+		{
+			REQUIRE_THROWS_AS(table.intern_id(std::to_string(i)), std::bad_alloc);
+		}
+		else
+		{
+			REQUIRE(table.intern_id(std::to_string(i)) == i - (i + 6) / 10);
+		}
+	}
+	REQUIRE(table.size() == 90);
+	fail = false;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		if (i % 10 == 3)
+		{
+			REQUIRE(!table.contains(std::to_string(i)));
+		}
+		else
+		{
+			REQUIRE(table.find_id(std::to_string(i)) == i - (i + 6) / 10);
+		}
+	}
+
+	CHECK(table.intern_id("3") == 90);
+	CHECK(table.get(90) == "3");
+	CHECK(table.size() == 91);
+}
+
+} // namespace
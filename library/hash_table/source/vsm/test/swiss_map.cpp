@@ -2,8 +2,19 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 using namespace vsm;
 
@@ -91,4 +102,677 @@ TEMPLATE_LIST_TEST_CASE("swiss_map insert & find", "[hash_table][swiss_table][sw
 	}
 }
 
+TEMPLATE_LIST_TEST_CASE("swiss_map find_many", "[hash_table][swiss_table][swiss_map]", map_types)
+{
+	using key_type = size_t;
+	using map_type = typename TestType::template type<key_type, size_t>;
+
+	size_t const count = GENERATE(as<size_t>(), 0, 1, 7, 20, 100, 1000);
+
+	map_type map;
+	for (size_t i = 0; i < count; ++i)
+	{
+		CHECK(map.insert(i * 2, i).inserted);
+	}
+
+	// Every other key is missing from the map.
+	std::vector<key_type> keys;
+	for (size_t i = 0; i < count * 2; ++i)
+	{
+		keys.push_back(i);
+	}
+	std::ranges::shuffle(keys, Catch::sharedRng());
+
+	std::vector<typename map_type::single_iterator> results(keys.size());
+	map.find_many(keys, results);
+
+	std::vector<typename map_type::const_single_iterator> const_results(keys.size());
+	std::as_const(map).find_many(keys, const_results);
+
+	auto const get_ptr = [&](auto const iterator) -> void const*
+	{
+		return iterator != map.end() ? &*iterator : nullptr;
+	};
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		void const* const expected = get_ptr(map.find(keys[i]));
+		CHECK(get_ptr(results[i]) == expected);
+		CHECK(get_ptr(const_results[i]) == expected);
+
+		if (keys[i] % 2 == 0)
+		{
+			REQUIRE(results[i] != map.end());
+			CHECK(results[i]->value == keys[i] / 2);
+		}
+		else
+		{
+			CHECK(results[i] == map.end());
+		}
+	}
+}
+
+TEST_CASE("swiss_map with precomputed hash", "[hash_table][swiss_table][swiss_map]")
+{
+	swiss_map<std::string, size_t> map_1;
+	swiss_map<std::string, size_t> map_2;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		size_t const hash = map_1.hash(std::string_view(key));
+
+		CHECK(map_1.insert_with_hash(hash, key, i).inserted);
+		CHECK(map_2.insert_with_hash(hash, key, i * 2).inserted);
+		CHECK(!map_2.insert_with_hash(hash, key, i * 3).inserted);
+	}
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		std::string_view const key_view = key;
+		size_t const hash = map_2.hash(key_view);
+
+		auto const it_1 = map_1.find_with_hash(hash, key_view);
+		REQUIRE(it_1 != map_1.end());
+		CHECK(it_1->value == i);
+
+		auto const it_2 = std::as_const(map_2).find_with_hash(hash, key_view);
+		REQUIRE(it_2 != map_2.end());
+		CHECK(it_2->value == i * 2);
+
+		if (i % 2 == 0)
+		{
+			CHECK(map_1.erase_with_hash(hash, key_view) == 1);
+			CHECK(map_1.erase_with_hash(hash, key_view) == 0);
+			CHECK(map_1.find_with_hash(hash, key_view) == map_1.end());
+		}
+	}
+
+	CHECK(map_1.size() == 50);
+	CHECK(map_2.size() == 100);
+}
+
+// Runs the tasks on a few threads, counting the number of invocations.
+struct thread_executor
+{
+	size_t* invocation_count;
+
+	void operator()(size_t const task_count, auto const& task) const
+	{
+		++*invocation_count;
+
+		std::atomic<size_t> next_task_index = 0;
+		auto const run_tasks = [&]()
+		{
+			for (size_t i; (i = next_task_index++) < task_count;)
+			{
+				task(i);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < 3; ++i)
+		{
+			threads.emplace_back(run_tasks);
+		}
+		run_tasks();
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+};
+
+// Runs the first few tasks and then throws, as if it had failed to start the remaining tasks.
+struct throwing_executor
+{
+	size_t run_task_count;
+
+	void operator()(size_t const task_count, auto const& task) const
+	{
+		for (size_t i = 0; i < std::min(run_task_count, task_count); ++i)
+		{
+			task(i);
+		}
+		throw std::runtime_error("executor failure");
+	}
+};
+
+// Starts the probe sequence of every key in the first few slots of the table.
+struct clustering_hasher
+{
+	size_t operator()(size_t const key) const
+	{
+		return (key % 16) << 7 | (key & 0x7F);
+	}
+};
+
+TEST_CASE("swiss_map parallel reserve", "[hash_table][swiss_table][swiss_map]")
+{
+	size_t invocation_count = 0;
+	thread_executor const executor{ &invocation_count };
+
+	SECTION("small table")
+	{
+		swiss_map<size_t, size_t> map;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			map.insert(i, i * 2);
+		}
+
+		map.reserve(10000, executor);
+		CHECK(invocation_count == 0);
+		CHECK(map.capacity() >= 10000);
+
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			REQUIRE(map.at(i) == i * 2);
+		}
+	}
+
+	SECTION("large table")
+	{
+		swiss_map<size_t, size_t> map;
+		for (size_t i = 0; i < 200'000; ++i)
+		{
+			map.insert(i * 3, i);
+		}
+
+		map.reserve(1'000'000, executor);
+		CHECK(invocation_count == 1);
+		CHECK(map.capacity() >= 1'000'000);
+		REQUIRE(map.size() == 200'000);
+
+		for (size_t i = 0; i < 200'000; ++i)
+		{
+			REQUIRE(map.at(i * 3) == i);
+			REQUIRE(!map.contains(i * 3 + 1));
+		}
+
+		size_t iterated_size = 0;
+		for ([[maybe_unused]] auto const& element : map)
+		{
+			++iterated_size;
+		}
+		CHECK(iterated_size == 200'000);
+	}
+
+	SECTION("clustered probe sequences")
+	{
+		swiss_map<size_t, size_t, default_key_selector, default_allocator, clustering_hasher> map;
+		map.reserve(30'000);
+
+		for (size_t i = 0; i < 3000; ++i)
+		{
+			map.insert(i, i);
+		}
+
+		map.reserve(100'000, executor);
+		CHECK(invocation_count == 1);
+		REQUIRE(map.size() == 3000);
+
+		for (size_t i = 0; i < 3000; ++i)
+		{
+			REQUIRE(map.at(i) == i);
+		}
+	}
+}
+
+TEST_CASE("swiss_map parallel reserve with throwing executor", "[hash_table][swiss_table][swiss_map]")
+{
+	size_t const run_task_count = GENERATE(as<size_t>(), 0, 3);
+
+	swiss_map<size_t, size_t> map;
+	for (size_t i = 0; i < 200'000; ++i)
+	{
+		map.insert(i * 3, i);
+	}
+
+	REQUIRE_THROWS_AS(
+		map.reserve(1'000'000, throwing_executor{ run_task_count }),
+		std::runtime_error);
+
+	CHECK(map.capacity() >= 1'000'000);
+	REQUIRE(map.size() == 200'000);
+
+	for (size_t i = 0; i < 200'000; ++i)
+	{
+		REQUIRE(map.at(i * 3) == i);
+	}
+
+	size_t iterated_size = 0;
+	for ([[maybe_unused]] auto const& element : map)
+	{
+		++iterated_size;
+	}
+	CHECK(iterated_size == 200'000);
+}
+
+TEST_CASE("swiss_map interleaved insert & erase", "[hash_table][swiss_table][swiss_map]")
+{
+	swiss_map<size_t, size_t> map;
+	std::unordered_map<size_t, size_t> std_map;
+
+	for (size_t i = 0; i < 5000; ++i)
+	{
+		map.insert(i, i);
+		std_map.emplace(i, i);
+
+		if (i % 3 == 0)
+		{
+			CHECK(map.erase(i / 2) == std_map.erase(i / 2));
+		}
+	}
+
+	REQUIRE(map.size() == std_map.size());
+	for (auto const& [key, value] : std_map)
+	{
+		auto const it = map.find(key);
+		REQUIRE(it != map.end());
+		CHECK(it->value == value);
+	}
+}
+
+TEST_CASE("swiss_map compact", "[hash_table][swiss_table][swiss_map]")
+{
+	swiss_map<size_t, size_t> map;
+	map.reserve(1000);
+
+	size_t const capacity = map.capacity();
+	for (size_t i = 0; i < capacity; ++i)
+	{
+		map.insert(i, i);
+	}
+	REQUIRE(map.capacity() == capacity);
+	CHECK(map.tombstone_count() == 0);
+	CHECK(map.average_probe_length() >= 1);
+
+	// Erasing elements from full groups leaves tombstones behind.
+	for (size_t i = 0; i < capacity; i += 2)
+	{
+		CHECK(map.erase(i) == 1);
+	}
+	CHECK(map.tombstone_count() != 0);
+
+	map.compact();
+	CHECK(map.tombstone_count() == 0);
+	CHECK(map.capacity() == capacity);
+
+	REQUIRE(map.size() == capacity / 2);
+	for (size_t i = 0; i < capacity; ++i)
+	{
+		auto const* const element = map.find_ptr(i);
+		if (i % 2 == 0)
+		{
+			CHECK(element == nullptr);
+		}
+		else
+		{
+			REQUIRE(element != nullptr);
+			CHECK(element->value == i);
+		}
+	}
+
+	size_t iterated_size = 0;
+	for (auto const& element : map)
+	{
+		CHECK(element.key % 2 == 1);
+		++iterated_size;
+	}
+	CHECK(iterated_size == map.size());
+}
+
+TEST_CASE("swiss_map max_tombstone_ratio", "[hash_table][swiss_table][swiss_map]")
+{
+	static constexpr float max_tomb_ratio = 0.05f;
+
+	using map_type = swiss_map<
+		std::string,
+		size_t,
+		default_key_selector,
+		default_allocator,
+		default_hasher,
+		std::equal_to<>,
+		max_tombstone_ratio_rehash>;
+
+	map_type map;
+	map.reserve(1000);
+	CHECK(map.max_tombstone_ratio() == 0);
+	map.set_max_tombstone_ratio(max_tomb_ratio);
+	CHECK(map.max_tombstone_ratio() == max_tomb_ratio);
+
+	size_t const capacity = map.capacity();
+	size_t const live_size = capacity * 3 / 4;
+	size_t const max_tomb_count = static_cast<size_t>(
+		max_tomb_ratio * static_cast<float>(capacity * 8 / 7)) + 1;
+
+	// Simulate a cache with constant churn, keeping live_size elements.
+	for (size_t i = 0; i < capacity * 20; ++i)
+	{
+		map.insert(std::to_string(i), i);
+
+		if (i >= live_size)
+		{
+			CHECK(map.erase(std::to_string(i - live_size)) == 1);
+			CHECK(map.tombstone_count() <= max_tomb_count);
+		}
+	}
+
+	CHECK(map.capacity() == capacity);
+	REQUIRE(map.size() == live_size);
+
+	for (size_t i = capacity * 20 - live_size; i < capacity * 20; ++i)
+	{
+		auto const* const element = map.find_ptr(std::to_string(i));
+		REQUIRE(element != nullptr);
+		CHECK(element->value == i);
+	}
+}
+
+TEST_CASE("swiss_map statistics", "[hash_table][swiss_table][swiss_map]")
+{
+	auto const sum = [](auto const& histogram)
+	{
+		size_t sum = 0;
+		for (size_t const count : histogram)
+		{
+			sum += count;
+		}
+		return sum;
+	};
+
+	auto const weighted_sum = [](auto const& histogram)
+	{
+		size_t sum = 0;
+		for (size_t i = 0; i < histogram.size(); ++i)
+		{
+			sum += i * histogram[i];
+		}
+		return sum;
+	};
+
+	SECTION("empty")
+	{
+		swiss_map<size_t, size_t> const map;
+		auto const statistics = map.statistics();
+
+		CHECK(statistics.size == 0);
+		CHECK(statistics.tombstone_count == 0);
+		CHECK(statistics.max_probe_length == 0);
+		CHECK(sum(statistics.probe_length_histogram) == 0);
+	}
+
+	SECTION("default hasher")
+	{
+		swiss_map<size_t, size_t> map;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			map.insert(i, i);
+		}
+
+		auto const statistics = map.statistics();
+
+		CHECK(statistics.size == map.size());
+		CHECK(statistics.capacity == map.capacity());
+		CHECK(statistics.slot_count >= statistics.capacity);
+		CHECK(statistics.tombstone_count == map.tombstone_count());
+		CHECK(statistics.max_probe_length >= 1);
+		CHECK(sum(statistics.probe_length_histogram) == map.size());
+		CHECK(weighted_sum(statistics.group_occupancy_histogram) == map.size());
+
+		double const average_probe_length =
+			static_cast<double>(weighted_sum(statistics.probe_length_histogram) + map.size()) /
+			static_cast<double>(map.size());
+
+		CHECK(std::abs(average_probe_length - map.average_probe_length()) < 1e-9);
+	}
+
+	SECTION("bad hasher")
+	{
+		struct bad_hasher
+		{
+			size_t operator()(size_t const key) const
+			{
+				return key % 4;
+			}
+		};
+
+		swiss_map<size_t, size_t, default_key_selector, default_allocator, bad_hasher> map;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			map.insert(i, i);
+		}
+
+		auto const statistics = map.statistics();
+
+		CHECK(statistics.max_probe_length > 4);
+		CHECK(sum(statistics.probe_length_histogram) == map.size());
+	}
+}
+
+TEMPLATE_LIST_TEST_CASE("swiss_map copy", "[hash_table][swiss_table][swiss_map]", map_types)
+{
+	using map_type = typename TestType::template type<size_t, std::string>;
+
+	auto const make_map = [](size_t const size, size_t const offset)
+	{
+		map_type map;
+		for (size_t i = 0; i < size; ++i)
+		{
+			map.insert(i + offset, std::to_string(i + offset));
+		}
+		return map;
+	};
+
+	auto const check_map = [](map_type const& map, size_t const size, size_t const offset)
+	{
+		REQUIRE(map.size() == size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto const* const element = map.find_ptr(i + offset);
+			REQUIRE(element != nullptr);
+			CHECK(element->value == std::to_string(i + offset));
+		}
+	};
+
+	size_t const size = GENERATE(as<size_t>(), 0, 10, 1000);
+
+	map_type const map = make_map(size, 0);
+
+	SECTION("construction")
+	{
+		map_type copy = map;
+		check_map(copy, size, 0);
+
+		// The copy is independent of the original.
+		copy.insert(size, "");
+		CHECK(map.size() == size);
+	}
+
+	SECTION("assignment, equal capacity")
+	{
+		map_type copy = make_map(size, 1);
+		copy = map;
+		check_map(copy, size, 0);
+	}
+
+	SECTION("assignment, different capacity")
+	{
+		map_type copy = make_map(size == 1000 ? 10 : 1000, 1);
+		copy = map;
+		check_map(copy, size, 0);
+	}
+
+	SECTION("self assignment")
+	{
+		map_type copy = map;
+		copy = std::as_const(copy);
+		check_map(copy, size, 0);
+	}
+}
+
+TEMPLATE_LIST_TEST_CASE("swiss_map insert_range", "[hash_table][swiss_table][swiss_map]", map_types)
+{
+	using map_type = typename TestType::template type<size_t, std::string>;
+
+	size_t const size = GENERATE(as<size_t>(), 0, 10, 1000);
+
+	std::vector<key_value_pair<size_t, std::string>> elements;
+	for (size_t i = 0; i < size; ++i)
+	{
+		elements.push_back({ i, std::to_string(i) });
+	}
+
+	auto const check_map = [&](map_type const& map)
+	{
+		REQUIRE(map.size() == size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto const* const element = map.find_ptr(i);
+			REQUIRE(element != nullptr);
+			CHECK(element->value == std::to_string(i));
+		}
+	};
+
+	SECTION("from range")
+	{
+		map_type const map(std::from_range, elements);
+		check_map(map);
+	}
+
+	SECTION("from range, unique keys")
+	{
+		map_type const map(std::from_range, unique_keys, elements);
+		check_map(map);
+	}
+
+	SECTION("duplicate keys")
+	{
+		map_type map;
+		map.insert(size_t(0), "existing");
+
+		auto duplicates = elements;
+		duplicates.push_back({ size_t(1), "duplicate" });
+
+		map.insert_range(duplicates);
+
+		REQUIRE(map.size() == std::max(size, size_t(2)));
+		CHECK(map.find_ptr(size_t(0))->value == "existing");
+		if (size > 1)
+		{
+			CHECK(map.find_ptr(size_t(1))->value == "1");
+		}
+	}
+
+	SECTION("tuple-like elements")
+	{
+		std::vector<std::pair<size_t, std::string>> pairs;
+		for (auto const& element : elements)
+		{
+			pairs.emplace_back(element.key, element.value);
+		}
+
+		map_type map;
+		map.insert_range(
+			unique_keys,
+			std::ranges::subrange(
+				std::make_move_iterator(pairs.begin()),
+				std::make_move_iterator(pairs.end())));
+		check_map(map);
+	}
+
+	SECTION("non-sized range")
+	{
+		map_type map;
+		map.insert_range(
+			elements | std::views::filter([](auto const&) { return true; }));
+		check_map(map);
+	}
+}
+
+TEST_CASE("swiss_map trivial copy", "[hash_table][swiss_table][swiss_map]")
+{
+	swiss_map<size_t, size_t> map;
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		map.insert(i, i * 2);
+	}
+	map.erase(size_t(0));
+
+	swiss_map<size_t, size_t> copy;
+	copy.insert(size_t(1000), size_t(0));
+	copy = map;
+
+	REQUIRE(copy.size() == map.size());
+	CHECK(copy.capacity() == map.capacity());
+	CHECK(copy.tombstone_count() == map.tombstone_count());
+	CHECK(copy.find_ptr(size_t(0)) == nullptr);
+	CHECK(copy.find_ptr(size_t(1000)) == nullptr);
+
+	for (size_t i = 1; i < 1000; ++i)
+	{
+		auto const* const element = copy.find_ptr(i);
+		REQUIRE(element != nullptr);
+		CHECK(element->value == i * 2);
+	}
+}
+
+struct copy_error {};
+
+struct throwing_value
+{
+	static inline size_t copies_until_throw = static_cast<size_t>(-1);
+	static inline ptrdiff_t live_count = 0;
+
+	throwing_value()
+	{
+		++live_count;
+	}
+
+	throwing_value(throwing_value const&)
+	{
+		if (copies_until_throw-- == 0)
+		{
+			throw copy_error{};
+		}
+		++live_count;
+	}
+
+	throwing_value& operator=(throwing_value const&) = default;
+
+	~throwing_value()
+	{
+		--live_count;
+	}
+};
+
+TEST_CASE("swiss_map copy exception safety", "[hash_table][swiss_table][swiss_map]")
+{
+	{
+		swiss_map<size_t, throwing_value> map;
+		for (size_t i = 0; i < 100; ++i)
+		{
+			map.try_emplace(i);
+		}
+		REQUIRE(throwing_value::live_count == 100);
+
+		throwing_value::copies_until_throw = 50;
+		CHECK_THROWS_AS((swiss_map<size_t, throwing_value>(map)), copy_error);
+		CHECK(throwing_value::live_count == 100);
+
+		swiss_map<size_t, throwing_value> copy;
+		copy.try_emplace(size_t(1000));
+
+		throwing_value::copies_until_throw = 50;
+		CHECK_THROWS_AS(copy = map, copy_error);
+		CHECK(copy.empty());
+		CHECK(throwing_value::live_count == 100);
+
+		throwing_value::copies_until_throw = static_cast<size_t>(-1);
+	}
+	CHECK(throwing_value::live_count == 0);
+}
+
 } // namespace
@@ -0,0 +1,182 @@
+#include <vsm/swiss_node_map.hpp>
+
+#include <vsm/testing/allocator.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+struct pinned_value
+{
+	size_t value;
+	pinned_value const* self;
+
+	explicit pinned_value(size_t const value)
+		: value(value)
+		, self(this)
+	{
+	}
+
+	pinned_value(pinned_value const&) = delete;
+	pinned_value& operator=(pinned_value const&) = delete;
+};
+
+struct node_allocation_error {};
+
+struct throwing_value
+{
+	explicit throwing_value(bool const do_throw)
+	{
+		if (do_throw)
+		{
+			throw node_allocation_error{};
+		}
+	}
+};
+
+TEST_CASE("swiss_node_map", "[hash_table][swiss_table][swiss_node_map]")
+{
+	swiss_node_map<std::string, size_t> map;
+	std::unordered_map<std::string, size_t> std_map;
+
+	auto const check_equal = [&]()
+	{
+		REQUIRE(map.size() == std_map.size());
+
+		for (auto const& [key, value] : std_map)
+		{
+			auto const* const element = std::as_const(map).find_ptr(key);
+			REQUIRE(element != nullptr);
+			REQUIRE(element->value == value);
+		}
+
+		size_t iterated_size = 0;
+		for (auto const& element : std::as_const(map))
+		{
+			auto const it = std_map.find(element.key);
+			REQUIRE(it != std_map.end());
+			REQUIRE(it->second == element.value);
+			++iterated_size;
+		}
+		REQUIRE(iterated_size == std_map.size());
+	};
+
+	for (size_t i = 0; i < 2000; ++i)
+	{
+		std::string const key = std::to_string(i);
+
+		CHECK(map.insert(key, i).inserted);
+		CHECK(!map.insert(key, 0u).inserted);
+		std_map.emplace(key, i);
+
+		if (i % 3 == 0)
+		{
+			std::string const erase_key = std::to_string(i / 2);
+			CHECK(map.erase(erase_key) == std_map.erase(erase_key));
+		}
+
+		if (i % 5 == 0)
+		{
+			std::string const assign_key = std::to_string(i / 4);
+			if (auto const it = std_map.find(assign_key); it != std_map.end())
+			{
+				CHECK(!map.insert_or_assign(assign_key, i).inserted);
+				it->second = i;
+			}
+		}
+	}
+	check_equal();
+
+	auto const it = map.find(std::string("1999"));
+	REQUIRE(it != map.end());
+	map.erase(it);
+	std_map.erase("1999");
+	check_equal();
+
+	CHECK(map.at_ptr(std::string("1999")) == nullptr);
+	CHECK_THROWS_AS(map.at(std::string("1999")), std::out_of_range);
+
+	map.clear();
+	CHECK(map.empty());
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("swiss_node_map reference stability", "[hash_table][swiss_table][swiss_node_map]")
+{
+	swiss_node_map<size_t, pinned_value> map;
+
+	std::vector<pinned_value const*> values;
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		auto const r = map.try_emplace(i, i);
+		REQUIRE(r.inserted);
+		values.push_back(&r.iterator->value);
+	}
+
+	map.reserve(100'000);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		pinned_value const* const value = map.at_ptr(i);
+		REQUIRE(value == values[i]);
+		REQUIRE(value->self == value);
+		REQUIRE(value->value == i);
+	}
+
+	auto moved_map = std::move(map);
+	CHECK(moved_map.size() == 1000);
+	CHECK(moved_map.at_ptr(size_t(0)) == values[0]);
+}
+
+TEST_CASE("swiss_node_map node allocator", "[hash_table][swiss_table][swiss_node_map]")
+{
+	using map_type = swiss_node_map<
+		size_t,
+		std::string,
+		default_key_selector,
+		default_allocator,
+		test::allocator>;
+
+	test::allocation_scope const scope;
+	{
+		map_type map;
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			map.insert(i, std::to_string(i));
+		}
+		CHECK(scope.get_allocation_count() == 100);
+
+		for (size_t i = 0; i < 100; i += 2)
+		{
+			CHECK(map.erase(i) == 1);
+		}
+		CHECK(scope.get_allocation_count() == 50);
+	}
+	CHECK(scope.get_allocation_count() == 0);
+}
+
+TEST_CASE("swiss_node_map exception safety", "[hash_table][swiss_table][swiss_node_map]")
+{
+	swiss_node_map<size_t, throwing_value> map;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		REQUIRE(map.try_emplace(i, false).inserted);
+	}
+
+	CHECK_THROWS_AS(map.try_emplace(size_t(100), true), node_allocation_error);
+	CHECK(map.size() == 100);
+	CHECK(!map.contains(size_t(100)));
+
+	CHECK(map.try_emplace(size_t(100), false).inserted);
+	CHECK(map.size() == 101);
+}
+
+} // namespace
@@ -2,6 +2,14 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 using namespace vsm;
 
 TEST_CASE("swiss_table full tombs", "[hash_table][swiss_table]")
@@ -19,3 +27,156 @@ TEST_CASE("swiss_table full tombs", "[hash_table][swiss_table]")
 		REQUIRE(set.erase(k));
 	}
 }
+
+TEST_CASE("swiss_set heterogeneous insert & erase", "[hash_table][swiss_table]")
+{
+	swiss_set<std::string> set;
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		REQUIRE(set.insert(std::string_view(key)).inserted);
+		REQUIRE(!set.insert(std::string_view(key)).inserted);
+	}
+	REQUIRE(set.size() == 100);
+
+	for (size_t i = 0; i < 100; i += 2)
+	{
+		std::string const key = std::to_string(i);
+		REQUIRE(set.erase(std::string_view(key)) == 1);
+		REQUIRE(set.erase(std::string_view(key)) == 0);
+	}
+	REQUIRE(set.size() == 50);
+
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::string const key = std::to_string(i);
+		CHECK(set.contains(std::string_view(key)) == (i % 2 != 0));
+	}
+}
+
+TEST_CASE("swiss_set erase keeps the remaining keys reachable", "[hash_table][swiss_table]")
+{
+	size_t const count = GENERATE(as<size_t>(), 14, 100, 1000, 10000);
+
+	swiss_set<size_t> set;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		REQUIRE(set.insert(i).inserted);
+	}
+
+	for (size_t i = 0; i < count; i += 3)
+	{
+		REQUIRE(set.erase(i));
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		CHECK(set.contains(i) == (i % 3 != 0));
+	}
+}
+
+TEST_CASE("swiss_set refresh keeps the remaining keys", "[hash_table][swiss_table]")
+{
+	swiss_set<
+		size_t,
+		default_key_selector,
+		default_allocator,
+		/* Hasher: */ std::identity> set;
+
+	set.reserve(100);
+	size_t const capacity = set.capacity();
+
+	// Fill the table, such that erasing leaves behind tombs and no slots are free.
+	for (size_t i = 0; i < capacity; ++i)
+	{
+		REQUIRE(set.insert(i).inserted);
+	}
+	for (size_t i = 10; i < capacity; ++i)
+	{
+		REQUIRE(set.erase(i));
+	}
+
+	// Probing for each key starts from a different slot. Once an empty slot is selected instead of
+	// a tomb, the table is refreshed in place.
+	for (size_t i = 1; i < 128; ++i)
+	{
+		REQUIRE(set.insert(i << 7).inserted);
+		REQUIRE(set.erase(i << 7));
+	}
+	REQUIRE(set.capacity() == capacity);
+	REQUIRE(set.size() == 10);
+
+	for (size_t i = 0; i < 10; ++i)
+	{
+		CHECK(set.contains(i));
+	}
+}
+
+TEST_CASE("swiss_set insert_range", "[hash_table][swiss_table]")
+{
+	SECTION("forward range")
+	{
+		std::vector<size_t> keys;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			keys.push_back(i % 500);
+		}
+
+		swiss_set<size_t> set(std::from_range, keys);
+		REQUIRE(set.size() == 500);
+
+		for (size_t i = 0; i < 500; ++i)
+		{
+			CHECK(set.contains(i));
+		}
+	}
+
+	SECTION("unique keys")
+	{
+		swiss_set<size_t> set;
+		set.insert(size_t(1000));
+		set.insert_range(unique_keys, std::views::iota(size_t(0), size_t(1000)));
+		REQUIRE(set.size() == 1001);
+
+		for (size_t i = 0; i <= 1000; ++i)
+		{
+			CHECK(set.contains(i));
+		}
+	}
+
+	SECTION("contiguous range")
+	{
+		std::vector<uint32_t> keys;
+		for (uint32_t i = 0; i < 1001; ++i)
+		{
+			keys.push_back(i * 7);
+		}
+
+		swiss_set<uint32_t> set;
+		set.insert_range(unique_keys, std::span<uint32_t const>(keys).first(500));
+		set.insert_range(keys);
+		REQUIRE(set.size() == 1001);
+
+		for (uint32_t const key : keys)
+		{
+			CHECK(set.contains(key));
+			CHECK(set.hash(key) == default_hasher()(key));
+		}
+	}
+
+	SECTION("input range")
+	{
+		std::istringstream stream("3 1 4 1 5 9 2 6 5 3 5");
+
+		swiss_set<size_t> set;
+		set.insert_range(std::views::istream<size_t>(stream));
+		REQUIRE(set.size() == 7);
+
+		for (size_t const key : std::initializer_list<size_t>{ 1, 2, 3, 4, 5, 6, 9 })
+		{
+			CHECK(set.contains(key));
+		}
+	}
+}
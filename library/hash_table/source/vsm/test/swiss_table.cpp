@@ -18,6 +18,14 @@ using group_types = std::tuple<
 #if vsm_arch_x86
 	, _swiss_table_group_x86
 #endif
+
+#if vsm_arch_x86_avx2
+	, _swiss_table_group_avx2
+#endif
+
+#if vsm_arch_x86_avx512bw
+	, _swiss_table_group_avx512
+#endif
 >;
 
 TEMPLATE_LIST_TEST_CASE("swiss table group hash matching", "[hash_table][swiss_table]", group_types)
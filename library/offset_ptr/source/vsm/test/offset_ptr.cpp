@@ -2,6 +2,8 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <cstring>
+
 using namespace vsm;
 
 namespace {
@@ -281,6 +281,45 @@ T* _vector_reserve_at(_vector_base<A>& vector, size_t const index, size_t const
 		}
 	}
 
+	// The allocator moves the bytes of the old block, possibly without copying them.
+	if constexpr (allocators::has_reallocate_v<A> && is_trivially_relocatable_v<T>)
+	{
+		if (_vector_has_ptr(vector))
+		{
+			vsm_vector_annotate(remove, vector);
+
+			auto const new_allocation = allocators::reallocate(
+				vector.m_allocator,
+				allocation(old_ptr, old_allocation_size),
+				min_allocation_size,
+				static_cast<size_t>(-1));
+
+			if (new_allocation.storage != nullptr)
+			{
+				new_capacity = new_allocation.size / sizeof(T);
+
+				T* const new_ptr = static_cast<T*>(new_allocation.storage);
+				T* const new_pos = new_ptr + index;
+
+				if (index != old_size)
+				{
+					vsm::uninitialized_relocate_backward(
+						new_pos,
+						new_ptr + old_size,
+						new_ptr + new_size);
+				}
+
+				vector._set(new_capacity, false);
+				vector._set_storage_ptr(new_ptr);
+				vsm_vector_annotate(create, vector);
+
+				return new_pos;
+			}
+
+			vsm_vector_annotate(create, vector);
+		}
+	}
+
 	T* const new_ptr = _vector_allocate<T>(vector, new_capacity);
 	T* const new_pos = new_ptr + index;
 
@@ -1006,6 +1045,8 @@ public:
 
 			vsm_except_rethrow;
 		}
+
+		return hole;
 	}
 
 	template<std::input_iterator Iterator>
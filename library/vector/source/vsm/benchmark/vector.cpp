@@ -0,0 +1,427 @@
+#include <vsm/vector.hpp>
+
+#include <vsm/testing/allocator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace vsm;
+
+namespace {
+
+static constexpr size_t small_vector_capacity = 16;
+
+// Sizes around the inline capacity of the small vector, up to vectors far larger than the caches.
+static constexpr size_t vector_sizes[] =
+{
+	4,
+	small_vector_capacity,
+	small_vector_capacity + 1,
+	size_t(1) << 8,
+	size_t(1) << 12,
+	size_t(1) << 16,
+	size_t(1) << 20,
+};
+
+// Inserting and erasing in the middle is linear in the size of the vector.
+static constexpr size_t max_quadratic_size = size_t(1) << 12;
+
+
+// Counts every allocation made through the test allocator, including those already deallocated.
+static size_t g_allocation_count = 0;
+
+class counting_allocator
+{
+public:
+	static constexpr bool is_always_equal = true;
+	static constexpr bool is_propagatable = true;
+
+	[[nodiscard]] allocation allocate(size_t const min_size, size_t const max_size) const noexcept
+	{
+		++g_allocation_count;
+		return test::allocator().allocate(min_size, max_size);
+	}
+
+	void deallocate(allocation const allocation) const noexcept
+	{
+		test::allocator().deallocate(allocation);
+	}
+};
+
+template<typename T>
+class counting_std_allocator
+{
+public:
+	using value_type = T;
+
+	counting_std_allocator() = default;
+
+	template<typename U>
+	counting_std_allocator(counting_std_allocator<U> const&)
+	{
+	}
+
+	[[nodiscard]] T* allocate(size_t const count)
+	{
+		size_t const size = count * sizeof(T);
+		auto const allocation = counting_allocator().allocate(size, size);
+
+		if (allocation.storage == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return static_cast<T*>(allocation.storage);
+	}
+
+	void deallocate(T* const storage, size_t const count)
+	{
+		counting_allocator().deallocate(allocation(storage, count * sizeof(T)));
+	}
+
+	friend bool operator==(counting_std_allocator const&, counting_std_allocator const&) = default;
+};
+
+
+struct u64_elements
+{
+	using type = uint64_t;
+	static constexpr char const* name = "u64";
+
+	static type make(size_t const index)
+	{
+		return index;
+	}
+};
+
+// Strings short enough to fit within the small string buffer. Their move constructors are not
+// trivial, so they are relocated element by element.
+struct string_elements
+{
+	using type = std::string;
+	static constexpr char const* name = "string";
+
+	static type make(size_t const index)
+	{
+		return std::to_string(index);
+	}
+};
+
+struct large_element
+{
+	uint64_t values[16];
+};
+
+struct large_elements
+{
+	using type = large_element;
+	static constexpr char const* name = "large";
+
+	static type make(size_t const index)
+	{
+		return large_element{ { index } };
+	}
+};
+
+
+struct vector_type
+{
+	static constexpr char const* name = "vector";
+
+	template<typename T>
+	using type = vsm::vector<T>;
+
+	template<typename T>
+	using counted_type = vsm::vector<T, counting_allocator>;
+};
+
+struct small_vector_type
+{
+	static constexpr char const* name = "small_vector";
+
+	template<typename T>
+	using type = small_vector<T, small_vector_capacity>;
+
+	template<typename T>
+	using counted_type = small_vector<T, small_vector_capacity, counting_allocator>;
+};
+
+struct std_vector_type
+{
+	static constexpr char const* name = "std::vector";
+
+	template<typename T>
+	using type = std::vector<T>;
+
+	template<typename T>
+	using counted_type = std::vector<T, counting_std_allocator<T>>;
+};
+
+
+template<typename Elements>
+std::vector<typename Elements::type> make_elements(size_t const count)
+{
+	std::vector<typename Elements::type> elements;
+	elements.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		elements.push_back(Elements::make(i));
+	}
+
+	return elements;
+}
+
+template<typename Vector>
+void vector_resize_default(Vector& vector, size_t const size)
+{
+	if constexpr (requires { vector.resize_default(size); })
+	{
+		vector.resize_default(size);
+	}
+	else
+	{
+		// std::vector offers no default initializing resize. Trivial elements are zeroed.
+		vector.resize(size);
+	}
+}
+
+// Runs the workload once using the counting allocator, separately from the timed iterations,
+// because the test allocator maps separate pages for every allocation.
+template<typename VectorType, typename Elements>
+void count_allocations(benchmark::State& state, auto const& workload)
+{
+	using vector_type = typename VectorType::template counted_type<typename Elements::type>;
+
+	test::allocation_scope const scope;
+	g_allocation_count = 0;
+	{
+		vector_type vector;
+		workload(vector);
+
+		state.counters["live_allocations"] = static_cast<double>(scope.get_allocation_count());
+	}
+	state.counters["allocations"] = static_cast<double>(g_allocation_count);
+}
+
+
+template<typename VectorType, typename Elements>
+void benchmark_push_back(benchmark::State& state)
+{
+	using vector_type = typename VectorType::template type<typename Elements::type>;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const elements = make_elements<Elements>(size);
+
+	auto const workload = [&](auto& vector)
+	{
+		for (auto const& element : elements)
+		{
+			vector.push_back(element);
+		}
+	};
+
+	for (auto _ : state)
+	{
+		vector_type vector;
+		workload(vector);
+		benchmark::DoNotOptimize(vector.data());
+	}
+
+	count_allocations<VectorType, Elements>(state, workload);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename VectorType, typename Elements>
+void benchmark_emplace_middle(benchmark::State& state)
+{
+	using vector_type = typename VectorType::template type<typename Elements::type>;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const elements = make_elements<Elements>(size);
+
+	auto const workload = [&](auto& vector)
+	{
+		for (auto const& element : elements)
+		{
+			vector.emplace(vector.begin() + vector.size() / 2, element);
+		}
+	};
+
+	for (auto _ : state)
+	{
+		vector_type vector;
+		workload(vector);
+		benchmark::DoNotOptimize(vector.data());
+	}
+
+	count_allocations<VectorType, Elements>(state, workload);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// Erases all elements one by one from the middle of a full vector.
+template<typename VectorType, typename Elements>
+void benchmark_erase(benchmark::State& state)
+{
+	using vector_type = typename VectorType::template type<typename Elements::type>;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const elements = make_elements<Elements>(size);
+
+	auto const fill = [&](auto& vector)
+	{
+		vector.reserve(size);
+		for (auto const& element : elements)
+		{
+			vector.push_back(element);
+		}
+	};
+
+	auto const erase = [&](auto& vector)
+	{
+		while (!vector.empty())
+		{
+			vector.erase(vector.begin() + vector.size() / 2);
+		}
+	};
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		vector_type vector;
+		fill(vector);
+		state.ResumeTiming();
+
+		erase(vector);
+		benchmark::DoNotOptimize(vector.data());
+	}
+
+	count_allocations<VectorType, Elements>(state, [&](auto& vector)
+	{
+		fill(vector);
+		erase(vector);
+	});
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename VectorType, typename Elements>
+void benchmark_resize_default(benchmark::State& state)
+{
+	using vector_type = typename VectorType::template type<typename Elements::type>;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+
+	auto const workload = [&](auto& vector)
+	{
+		vector_resize_default(vector, size);
+	};
+
+	for (auto _ : state)
+	{
+		vector_type vector;
+		workload(vector);
+		benchmark::DoNotOptimize(vector.data());
+	}
+
+	count_allocations<VectorType, Elements>(state, workload);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// Swapping small vectors with inline elements relocates the elements.
+template<typename VectorType, typename Elements>
+void benchmark_swap(benchmark::State& state)
+{
+	using vector_type = typename VectorType::template type<typename Elements::type>;
+
+	size_t const size = static_cast<size_t>(state.range(0));
+	auto const elements = make_elements<Elements>(size);
+
+	auto const fill = [&](auto& vector)
+	{
+		for (auto const& element : elements)
+		{
+			vector.push_back(element);
+		}
+	};
+
+	vector_type vector_1;
+	vector_type vector_2;
+	fill(vector_1);
+	fill(vector_2);
+
+	for (auto _ : state)
+	{
+		vector_1.swap(vector_2);
+		benchmark::DoNotOptimize(vector_1.data());
+		benchmark::DoNotOptimize(vector_2.data());
+	}
+
+	count_allocations<VectorType, Elements>(state, [&](auto& vector)
+	{
+		std::remove_reference_t<decltype(vector)> other;
+		fill(vector);
+		fill(other);
+		vector.swap(other);
+	});
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+template<typename VectorType, typename Elements>
+void register_benchmarks()
+{
+	auto const register_benchmark = [](
+		char const* const workload,
+		void(*const function)(benchmark::State&),
+		size_t const max_size)
+	{
+		std::string name = VectorType::name;
+		name += '<';
+		name += Elements::name;
+		name += ">/";
+		name += workload;
+
+		auto* const b = benchmark::RegisterBenchmark(name.c_str(), function);
+
+		for (size_t const size : vector_sizes)
+		{
+			if (size <= max_size)
+			{
+				b->Arg(static_cast<int64_t>(size));
+			}
+		}
+	};
+
+	size_t const max_size = static_cast<size_t>(-1);
+
+	register_benchmark("push_back", benchmark_push_back<VectorType, Elements>, max_size);
+	register_benchmark(
+		"emplace_middle",
+		benchmark_emplace_middle<VectorType, Elements>,
+		max_quadratic_size);
+	register_benchmark("erase", benchmark_erase<VectorType, Elements>, max_quadratic_size);
+	register_benchmark("resize_default", benchmark_resize_default<VectorType, Elements>, max_size);
+	register_benchmark("swap", benchmark_swap<VectorType, Elements>, max_size);
+}
+
+template<typename VectorType>
+void register_benchmarks()
+{
+	register_benchmarks<VectorType, u64_elements>();
+	register_benchmarks<VectorType, string_elements>();
+	register_benchmarks<VectorType, large_elements>();
+}
+
+[[maybe_unused]] static bool const registered = []()
+{
+	register_benchmarks<vector_type>();
+	register_benchmarks<small_vector_type>();
+	register_benchmarks<std_vector_type>();
+	return true;
+}();
+
+} // namespace
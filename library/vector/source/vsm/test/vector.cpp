@@ -6,6 +6,8 @@
 
 #include <ranges>
 
+#include <cstdlib>
+
 using namespace vsm;
 
 namespace {
@@ -502,3 +504,58 @@ TEMPLATE_LIST_TEST_CASE("two vectors can be swapped", "[container][vector]", vec
 	}
 	REQUIRE(instance_count.empty());
 }
+
+namespace {
+
+static size_t reallocate_count = 0;
+
+struct reallocating_allocator
+{
+	allocation allocate(size_t const min_size, size_t) const noexcept
+	{
+		return allocation(std::malloc(min_size), min_size);
+	}
+
+	void deallocate(allocation const allocation) const noexcept
+	{
+		std::free(allocation.storage);
+	}
+
+	allocation reallocate(allocation const allocation, size_t const min_size, size_t) const noexcept
+	{
+		++reallocate_count;
+		return vsm::allocation(std::realloc(allocation.storage, min_size), min_size);
+	}
+};
+
+static_assert(allocators::has_reallocate_v<reallocating_allocator>);
+
+TEST_CASE("vector grows trivially relocatable elements by reallocation", "[container][vector]")
+{
+	reallocate_count = 0;
+	vector<trivial, reallocating_allocator> vec;
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		vec.push_back(i);
+	}
+	REQUIRE(reallocate_count != 0);
+
+	size_t const old_reallocate_count = reallocate_count;
+	vec.reserve(vec.capacity() + 1);
+	REQUIRE(reallocate_count == old_reallocate_count + 1);
+
+	// Inserting at the front relocates the existing elements within the reallocated block.
+	vec.shrink_to_fit();
+	vec.insert(vec.begin(), 1000, trivial(0));
+	REQUIRE(vec.size() == 2000);
+	REQUIRE(reallocate_count == old_reallocate_count + 2);
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(vec[i].value == 0);
+		REQUIRE(vec[1000 + i].value == i);
+	}
+}
+
+} // namespace